@@ -0,0 +1,165 @@
+// Resolves component ids through ComponentRegistry and, for comparison, by
+// walking the inventory until the id turns up; then creates plants on several
+// threads at once to show per-thread id blocks keep ids unique and indexed,
+// checks that setId() refuses an id another component holds, and that a
+// snapshot clone takes its original's entry over once the original dies.
+// Usage: ComponentRegistryBench [plants] [plots] [lookups] [threads]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/ComponentRegistry.h"
+#include "../include/Components/ComponentTree.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// What resolving an id cost before the registry: a pre-order walk until it turns up.
+InventoryComponent* findByWalk(const Inventory& inventory, uint64_t id) {
+	const ComponentTree& tree = ComponentTree::shared();
+	InventoryComponent* found = nullptr;
+	for (const auto& root : inventory.getComponents()) {
+		tree.forEachPreOrder(root->treeNode(), [&](ComponentTree::Handle node) {
+			if (!found && tree.component(node)->getId() == id) found = tree.component(node);
+		});
+		if (found) break;
+	}
+	return found;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const long lookups = argc > 3 ? std::atol(argv[3]) : 1000000;
+	const unsigned threads = argc > 4 ? static_cast<unsigned>(std::atoi(argv[4])) : std::max(2u, std::thread::hardware_concurrency());
+
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	std::vector<uint64_t> ids;
+	for (long i = 0; i < plots; ++i) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(i)));
+		inventory->add(groups.back());
+	}
+	for (long i = 0; i < plants; ++i) {
+		auto rose = std::make_shared<Rose>("Rose", 25.0);
+		ids.push_back(rose->getId());
+		groups[static_cast<std::size_t>(i % plots)]->add(rose);
+	}
+
+	// Fixed pseudo-random probe order so runs are comparable.
+	uint64_t state = 42;
+	auto pick = [&] {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		return ids[static_cast<std::size_t>((state >> 33) % ids.size())];
+	};
+
+	const ComponentRegistry& registry = ComponentRegistry::shared();
+	uint64_t misses = 0;
+	const double registrySeconds = timed([&] {
+		for (long i = 0; i < lookups; ++i) {
+			const uint64_t id = pick();
+			const InventoryComponent* found = registry.find(id);
+			misses += !found || found->getId() != id;
+		}
+	});
+	// The same lookups over a few thousand ids that stay cached: what is left is the probe and its locking.
+	const std::size_t hotIds = std::min<std::size_t>(ids.size(), 4096);
+	const double hotSeconds = timed([&] {
+		for (long i = 0, next = 0; i < lookups; ++i) {
+			misses += registry.find(ids[static_cast<std::size_t>(next)]) == nullptr;
+			next = static_cast<std::size_t>(next + 1) == hotIds ? 0 : next + 1;
+		}
+	});
+	const long walks = std::max(1L, lookups / 10000);
+	const double walkSeconds = timed([&] {
+		for (long i = 0; i < walks; ++i) {
+			const uint64_t id = pick();
+			misses += findByWalk(*inventory, id) != registry.find(id);
+		}
+	});
+
+	// Concurrent creation: every thread builds its share of unowned plants.
+	const long perThread = plants / static_cast<long>(threads);
+	std::vector<std::vector<std::shared_ptr<Rose>>> created(threads);
+	const std::size_t indexedBefore = registry.size();
+	const double createSeconds = timed([&] {
+		std::vector<std::thread> workers;
+		for (unsigned t = 0; t < threads; ++t) {
+			workers.emplace_back([&created, perThread, t] {
+				created[t].reserve(static_cast<std::size_t>(perThread));
+				for (long i = 0; i < perThread; ++i) created[t].push_back(std::make_shared<Rose>("Rose", 25.0));
+			});
+		}
+		for (auto& worker : workers) worker.join();
+	});
+	std::unordered_set<uint64_t> unique;
+	for (const auto& batch : created) {
+		for (const auto& rose : batch) {
+			unique.insert(rose->getId());
+			misses += registry.find(rose->getId()) != rose.get();
+		}
+	}
+	const std::size_t expected = static_cast<std::size_t>(perThread) * threads;
+
+	// Re-keying onto an id a live component holds is refused, so neither of them drops out of the index.
+	bool collisionRefused = false;
+	if (expected >= 2) {
+		Rose& taker = *created[0][1];
+		const InventoryComponent& holder = *created[0][0];
+		try {
+			taker.setId(holder.getId());
+		} catch (const std::invalid_argument&) {
+			collisionRefused = true;
+		}
+		misses += registry.find(holder.getId()) != &holder || registry.find(taker.getId()) != &taker;
+	}
+
+	// Clones share their original's id: the original stays indexed while it lives, then the oldest clone.
+	bool cloneTookOver = false;
+	{
+		auto original = std::make_shared<Rose>("Rose", 25.0);
+		const uint64_t id = original->getId();
+		auto first = original->clone();
+		auto second = original->clone();
+		const bool originalFirst = registry.find(id) == original.get();
+		original.reset();
+		const bool firstNext = registry.find(id) == first.get();
+		first.reset();
+		cloneTookOver = originalFirst && firstNext && registry.find(id) == second.get();
+		second.reset();
+		cloneTookOver = cloneTookOver && registry.find(id) == nullptr;
+	}
+
+	std::cout << "plants=" << plants << " plots=" << plots << " indexed=" << indexedBefore << "\n";
+	std::cout << "registry find:   " << registrySeconds / lookups * 1e9 << " ns/lookup, "
+		<< hotSeconds / lookups * 1e9 << " ns/lookup on " << hotIds << " cached ids\n";
+	std::cout << "pre-order walk:  " << walkSeconds / walks * 1e9 << " ns/lookup ("
+		<< (walkSeconds / walks) / (registrySeconds / lookups) << "x slower)\n";
+	std::cout << "create on " << threads << " threads: " << expected / createSeconds << " components/s\n";
+
+	if (misses != 0 || (expected >= 2 && !collisionRefused) || !cloneTookOver || unique.size() != expected
+		|| registry.size() != indexedBefore + expected) {
+		std::cerr << "mismatch: registry lost or misfiled components\n";
+		return 1;
+	}
+	std::cout << "ids unique and resolvable: yes\n";
+	return 0;
+}
@@ -0,0 +1,102 @@
+// Walks a large inventory tree in pre-order three ways: the shared_ptr-based
+// CompositeIterator, ComponentTree handles as the tree was built (plants dealt
+// round-robin over the plots, so siblings sit far apart) and handles after
+// ComponentTree::defragment() has relaid the nodes in depth-first order. Also
+// checks that a ParallelWalk planned before the defragment() refuses to run.
+// Usage: ComponentTreeBench [plants] [plots] [passes]
+#include "../include/Core/Inventory.h"
+#include "../include/Core/ParallelWalk.h"
+#include "../include/Components/ComponentTree.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+#include "../include/Patterns/Iterator/Iterator.h"
+#include "../include/Patterns/Iterator/PreOrderTraversal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+// Sums ids so the walks cannot be optimized away and can be compared.
+uint64_t walkShared(Inventory& inventory) {
+	uint64_t sum = 0;
+	auto iterator = inventory.createIterator();
+	while (iterator->hasNext()) sum += iterator->next()->getId();
+	return sum;
+}
+
+uint64_t walkHandles(const Inventory& inventory) {
+	const ComponentTree& tree = ComponentTree::shared();
+	uint64_t sum = 0;
+	for (const auto& root : inventory.getComponents()) {
+		tree.forEachPreOrder(root->treeNode(), [&](ComponentTree::Handle node) { sum += tree.component(node)->getId(); });
+	}
+	return sum;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 4096;
+	const int passes = argc > 3 ? std::atoi(argv[3]) : 5;
+
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long i = 0; i < plots; ++i) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(i)));
+		inventory->add(groups.back());
+	}
+	for (long i = 0; i < plants; ++i) groups[static_cast<std::size_t>(i % plots)]->add(std::make_shared<Rose>("Rose", 25.0));
+
+	uint64_t sharedSum = 0;
+	uint64_t scatteredSum = 0;
+	uint64_t compactSum = 0;
+	const double sharedSeconds = timed(passes, [&] { sharedSum = walkShared(*inventory); });
+	const double scatteredSeconds = timed(passes, [&] { scatteredSum = walkHandles(*inventory); });
+	ComponentTree& tree = ComponentTree::shared();
+	const bool wasFragmented = tree.fragmented();
+	const ParallelWalk plannedBefore(*inventory);
+	const auto defragmentStart = std::chrono::steady_clock::now();
+	tree.defragment();
+	const double defragmentSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - defragmentStart).count();
+	const double compactSeconds = timed(passes, [&] { compactSum = walkHandles(*inventory); });
+
+	std::cout << "plants=" << plants << " plots=" << plots << " nodes=" << tree.size() << "\n";
+	std::cout << "shared_ptr iterator:    " << sharedSeconds * 1e3 << " ms/walk\n";
+	std::cout << "handles, build order:   " << scatteredSeconds * 1e3 << " ms/walk\n";
+	std::cout << "handles, defragmented:  " << compactSeconds * 1e3 << " ms/walk ("
+		<< sharedSeconds / compactSeconds << "x vs shared_ptr)\n";
+	std::cout << "defragment():           " << defragmentSeconds * 1e3 << " ms (fragmented=" << (wasFragmented ? "yes" : "no") << ")\n";
+
+	if (sharedSum != scatteredSum || sharedSum != compactSum) {
+		std::cerr << "mismatch: handle walks visited different components\n";
+		return 1;
+	}
+	std::cout << "same components visited: yes\n";
+
+	bool staleRejected = false;
+	try {
+		plannedBefore.forEach(nullptr, [](InventoryComponent&) {});
+	} catch (const std::logic_error&) {
+		staleRejected = true;
+	}
+	if (!plannedBefore.stale() || !staleRejected || ParallelWalk(*inventory).stale()) {
+		std::cerr << "stale ParallelWalk plan was not detected after defragment()\n";
+		return 1;
+	}
+	std::cout << "stale walk plan rejected: yes\n";
+	return 0;
+}
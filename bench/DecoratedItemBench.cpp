@@ -0,0 +1,98 @@
+// Builds the same potted, ribboned, gift-wrapped plants two ways, as a chain of
+// PotDecorator/RibbonDecorator/GiftWrapDecorator and as one DecoratedItem each,
+// then times building them, summing getPrice() and reading getName() over all
+// of them. Checks both give the same prices (to the bit) and names, and that a
+// blueprintClone() and serialize() of a DecoratedItem keep the add-ons.
+// Usage: DecoratedItemBench [items] [passes]
+#include "../include/Components/Rose.h"
+#include "../include/Patterns/Decorator/DecoratedItem.h"
+#include "../include/Patterns/Decorator/GiftWrapDecorator.h"
+#include "../include/Patterns/Decorator/PotDecorator.h"
+#include "../include/Patterns/Decorator/RibbonDecorator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long items = argc > 1 ? std::atol(argv[1]) : 200000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 5;
+
+	std::vector<std::shared_ptr<Rose>> plants;
+	plants.reserve(static_cast<std::size_t>(items));
+	for (long i = 0; i < items; ++i) plants.push_back(std::make_shared<Rose>("Rose", 20.0 + static_cast<double>(i % 100) / 10.0));
+
+	std::vector<std::shared_ptr<InventoryComponent>> chains(static_cast<std::size_t>(items));
+	std::vector<std::shared_ptr<InventoryComponent>> flat(static_cast<std::size_t>(items));
+	using AddOn = DecoratedItem::AddOn;
+	const double chainBuildSeconds = timed(1, [&] {
+		for (std::size_t i = 0; i < chains.size(); ++i) {
+			chains[i] = std::make_shared<GiftWrapDecorator>(std::make_shared<RibbonDecorator>(std::make_shared<PotDecorator>(plants[i])));
+		}
+	});
+	const double flatBuildSeconds = timed(1, [&] {
+		for (std::size_t i = 0; i < flat.size(); ++i) {
+			flat[i] = std::make_shared<DecoratedItem>(plants[i], std::initializer_list<AddOn>{AddOn::Pot, AddOn::Ribbon, AddOn::GiftWrap});
+		}
+	});
+
+	double chainTotal = 0.0;
+	double flatTotal = 0.0;
+	const double chainPriceSeconds = timed(passes, [&] {
+		chainTotal = 0.0;
+		for (const auto& item : chains) chainTotal += item->getPrice();
+	});
+	const double flatPriceSeconds = timed(passes, [&] {
+		flatTotal = 0.0;
+		for (const auto& item : flat) flatTotal += item->getPrice();
+	});
+
+	std::size_t chainChars = 0;
+	std::size_t flatChars = 0;
+	const double chainNameSeconds = timed(passes, [&] {
+		chainChars = 0;
+		for (const auto& item : chains) chainChars += item->getName().size();
+	});
+	const double flatNameSeconds = timed(passes, [&] {
+		flatChars = 0;
+		for (const auto& item : flat) flatChars += item->getName().size();
+	});
+
+	bool same = std::memcmp(&chainTotal, &flatTotal, sizeof chainTotal) == 0 && chainChars == flatChars;
+	for (std::size_t i = 0; same && i < chains.size(); i += 997) {
+		same = chains[i]->getName() == flat[i]->getName() && chains[i]->getPrice() == flat[i]->getPrice();
+	}
+	const auto blueprint = std::static_pointer_cast<DecoratedItem>(flat.front()->blueprintClone());
+	same = same && blueprint->getId() != flat.front()->getId() && blueprint->getName() == flat.front()->getName()
+		&& blueprint->addOnCount() == 3 && flat.front()->serialize().find("\"addOns\":[\"Pot\",\"Ribbon\",\"GiftWrap\"]") != std::string::npos;
+
+	std::cout << "items=" << items << " (pot + ribbon + gift wrap each)\n";
+	std::cout << "heap objects per item: chain 4, flat 2; wrapper size: chain " << sizeof(PotDecorator) + sizeof(RibbonDecorator)
+		+ sizeof(GiftWrapDecorator) << " B, flat " << sizeof(DecoratedItem) << " B\n";
+	std::cout << "build:     chain " << chainBuildSeconds * 1e3 << " ms, flat " << flatBuildSeconds * 1e3 << " ms\n";
+	std::cout << "getPrice:  chain " << chainPriceSeconds * 1e3 << " ms, flat " << flatPriceSeconds * 1e3 << " ms ("
+		<< chainPriceSeconds / flatPriceSeconds << "x)\n";
+	std::cout << "getName:   chain " << chainNameSeconds * 1e3 << " ms, flat " << flatNameSeconds * 1e3 << " ms ("
+		<< chainNameSeconds / flatNameSeconds << "x)\n";
+
+	if (!same) {
+		std::cerr << "mismatch: DecoratedItem differs from the decorator chain\n";
+		return 1;
+	}
+	std::cout << "same prices and names: yes\n";
+	return 0;
+}
@@ -0,0 +1,162 @@
+// Runs the same nursery day by day and with the event-driven simulateUntil(),
+// checks that both end in identical plant state, with every plot's cached
+// aggregates matching a recount, and reports how many simulated days per second
+// each reaches. The timed pair runs without customers, so most days only have a
+// few plants due; a shorter pair with customers buying plants checks the same.
+// A last timed pair leaves the plants unwatched (planted, not stocked): no
+// waterings are raised, so only their own event days cost anything.
+// Usage: FastForwardBench [plots] [plantsPerPlot] [days]
+#include "../include/Core/Nursery.h"
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Plant.h"
+#include "../include/Patterns/Factory/CactusFactory.h"
+#include "../include/Patterns/Factory/RoseFactory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Scenario {
+	std::shared_ptr<Nursery> nursery;
+	std::vector<std::shared_ptr<Group>> plots;
+	std::vector<std::shared_ptr<Plant>> plants;
+};
+
+// Stocked plants are watched by the supervisor, which has thirsty ones watered; planted ones are not.
+Scenario build(int plots, int plantsPerPlot, int customersPerDay, uint64_t plotIds, bool watched) {
+	Scenario scenario{std::make_shared<Nursery>(), {}, {}};
+	RoseFactory roses;
+	CactusFactory cacti;
+	scenario.nursery->setSeed(7);
+	scenario.nursery->setCustomersPerDay(customersPerDay);
+	for (int p = 0; p < plots; ++p) {
+		auto plot = scenario.nursery->addPlot("Plot " + std::to_string(p));
+		// Weather streams are keyed by plot id; pin ids so both runs draw the same weather.
+		plot->setId(plotIds + static_cast<uint64_t>(p));
+		scenario.plots.push_back(plot);
+		for (int i = 0; i < plantsPerPlot; ++i) {
+			const bool cactus = (i + p) % 3 == 0;
+			if (watched) {
+				scenario.plants.push_back(scenario.nursery->stockPlant(cactus ? "Cactus" : "Rose", plot));
+				continue;
+			}
+			scenario.plants.push_back(cactus ? cacti.createPlant() : roses.createPlant());
+			plot->add(scenario.plants.back());
+		}
+	}
+	return scenario;
+}
+
+uint64_t checksum(const Scenario& scenario) {
+	uint64_t sum = static_cast<uint64_t>(scenario.nursery->getCurrentDay());
+	for (const auto& plant : scenario.plants) {
+		sum = sum * 31 + static_cast<uint64_t>(plant->getAge());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getHealth());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getWaterLevel());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getStage());
+	}
+	for (uint64_t count : scenario.nursery->getLifecycleReport().population) sum = sum * 31 + count;
+	return sum * 31 + scenario.nursery->pendingRequests();
+}
+
+// Whether every plot's stage counts and minima, as kept by the tick, match its plants.
+bool aggregatesMatch(const Scenario& scenario) {
+	for (const auto& plot : scenario.plots) {
+		Group::Aggregates recount;
+		for (const auto& member : plot->members()) {
+			const auto& plant = static_cast<const Plant&>(*member);
+			++recount.stageCounts[static_cast<std::size_t>(plant.getStage())];
+			recount.minHealth = std::min(recount.minHealth, static_cast<int32_t>(plant.getHealth()));
+			recount.minWaterLevel = std::min(recount.minWaterLevel, static_cast<int32_t>(plant.getWaterLevel()));
+		}
+		const Group::Aggregates cached = plot->getAggregates();
+		if (cached.stageCounts != recount.stageCounts || cached.minHealth != recount.minHealth
+			|| cached.minWaterLevel != recount.minWaterLevel) {
+			return false;
+		}
+	}
+	return true;
+}
+
+struct Run {
+	double seconds;
+	uint64_t checksum;
+	bool aggregatesMatch;
+	int daysTicked;
+};
+
+// Builds a scenario and runs it for 'days', one day at a time or with simulateUntil().
+Run simulate(int plots, int plantsPerPlot, int customersPerDay, int days, bool eventDriven, uint64_t plotIds,
+	bool watched = true) {
+	Scenario scenario = build(plots, plantsPerPlot, customersPerDay, plotIds, watched);
+	int daysTicked = 0;
+	scenario.nursery->setPhaseTimer([&daysTicked](Nursery::Phase phase, std::chrono::nanoseconds) {
+		daysTicked += phase == Nursery::Phase::Tick;
+	});
+	const auto start = std::chrono::steady_clock::now();
+	if (eventDriven) scenario.nursery->simulateUntil(days);
+	else scenario.nursery->runSimulation(days);
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return {seconds, checksum(scenario), aggregatesMatch(scenario), daysTicked};
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const int plots = argc > 1 ? std::atoi(argv[1]) : 1;
+	const int plantsPerPlot = argc > 2 ? std::atoi(argv[2]) : 2000;
+	const int days = argc > 3 ? std::atoi(argv[3]) : 3650;
+
+	// Reserved, so no plant gets one; each run frees them before the next takes them.
+	const uint64_t plotIds = InventoryComponent::reserveIds(static_cast<uint64_t>(plots));
+	// The first scenario gets fresh memory and later ones recycled blocks; an untimed run puts both timed ones alike.
+	simulate(plots, plantsPerPlot, 0, std::min(days, 30), false, plotIds);
+	const Run daily = simulate(plots, plantsPerPlot, 0, days, false, plotIds);
+	const Run skipping = simulate(plots, plantsPerPlot, 0, days, true, plotIds);
+
+	std::cout << "plots=" << plots << " plants=" << plots * plantsPerPlot << " days=" << days << "\n";
+	std::cout << "day by day:     " << days / daily.seconds << " days/s\n";
+	std::cout << "simulateUntil:  " << days / skipping.seconds << " days/s\n";
+	std::cout << "speedup:        " << daily.seconds / skipping.seconds << "x\n";
+	std::cout << "days ticked:    " << skipping.daysTicked << " (" << days - skipping.daysTicked << " skipped as idle)\n";
+
+	if (daily.checksum != skipping.checksum) {
+		std::cerr << "mismatch: simulateUntil diverged from the day-by-day run\n";
+		return 1;
+	}
+	std::cout << "state identical: yes\n";
+	if (!daily.aggregatesMatch || !skipping.aggregatesMatch) {
+		std::cerr << "mismatch: a plot's cached aggregates differ from its plants\n";
+		return 1;
+	}
+	std::cout << "plot aggregates match a recount: yes\n";
+
+	// Customers buy plants every day: no day is idle, and the sales regroup the tick units.
+	const int shopDays = std::min(days, 365);
+	const Run shopDaily = simulate(plots, plantsPerPlot, 1, shopDays, false, plotIds);
+	const Run shopSkipping = simulate(plots, plantsPerPlot, 1, shopDays, true, plotIds);
+	if (shopDaily.checksum != shopSkipping.checksum || !shopDaily.aggregatesMatch || !shopSkipping.aggregatesMatch) {
+		std::cerr << "mismatch: simulateUntil diverged from the day-by-day run with customers\n";
+		return 1;
+	}
+	std::cout << "with customers (" << shopDays << " days): identical, " << shopDaily.seconds / shopSkipping.seconds
+		<< "x\n";
+
+	// Unwatched plants go unwatered: the tick is all there is, and most plants are due on few days.
+	const Run wildDaily = simulate(plots, plantsPerPlot, 0, days, false, plotIds, false);
+	const Run wildSkipping = simulate(plots, plantsPerPlot, 0, days, true, plotIds, false);
+	if (wildDaily.checksum != wildSkipping.checksum || !wildDaily.aggregatesMatch || !wildSkipping.aggregatesMatch) {
+		std::cerr << "mismatch: simulateUntil diverged from the day-by-day run with unwatched plants\n";
+		return 1;
+	}
+	std::cout << "unwatched plants: identical, " << days / wildDaily.seconds << " vs " << days / wildSkipping.seconds
+		<< " days/s, " << wildDaily.seconds / wildSkipping.seconds << "x (" << wildSkipping.daysTicked << " days ticked)\n";
+	return 0;
+}
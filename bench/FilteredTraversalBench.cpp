@@ -0,0 +1,160 @@
+// Runs two selective scans over a generated inventory where few plants match:
+// "plants with water level below 30" over the whole inventory and "withering
+// plants in plot X". Each is timed as a full walk that tests every component and
+// as a filtered traversal that skips subtrees whose cached aggregates rule out a
+// match, snapshot iterator and handle strategies alike. Also times the first
+// filtered scan after building the tree, which pays for computing every
+// aggregate, and after one plant turns thirsty, which only rebuilds its chain.
+// Checks every filtered scan yields exactly the full walk's matches, in order.
+// Usage: FilteredTraversalBench [plants] [plots] [thirstyPlots] [passes]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+#include "../include/Patterns/Iterator/FilteredLevelOrderTraversal.h"
+#include "../include/Patterns/Iterator/FilteredPreOrderTraversal.h"
+#include "../include/Patterns/Iterator/Iterator.h"
+#include "../include/Patterns/Iterator/LevelOrderTraversal.h"
+#include "../include/Patterns/Iterator/PreOrderTraversal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr int kThirsty = 30;
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+// Handles of 'nodes' that 'filter' matches, in their original order.
+std::vector<ComponentTree::Handle> keep(const std::vector<ComponentTree::Handle>& nodes, const TraversalFilter& filter) {
+	const ComponentTree& tree = ComponentTree::shared();
+	std::vector<ComponentTree::Handle> matches;
+	for (ComponentTree::Handle node : nodes) {
+		if (filter.matches(*tree.component(node))) matches.push_back(node);
+	}
+	return matches;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const long thirstyPlots = argc > 3 ? std::atol(argv[3]) : 4;
+	const int passes = argc > 4 ? std::atoi(argv[4]) : 5;
+
+	// Plots of beds of plants, all well watered except one plant in every tenth bed of the thirsty plots.
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long p = 0; p < plots; ++p) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(p)));
+		inventory->add(groups.back());
+	}
+	const long perPlot = plants / plots;
+	const long perBed = 64;
+	const long stride = std::max(1L, plots / std::max(1L, thirstyPlots));
+	long stocked = 0;
+	std::shared_ptr<Plant> lastPlant;
+	for (long p = 0; p < plots; ++p) {
+		std::shared_ptr<Group> bed;
+		for (long i = 0; i < perPlot; ++i, ++stocked) {
+			if (i % perBed == 0) {
+				bed = std::make_shared<Group>("Bed " + std::to_string(i / perBed));
+				groups[static_cast<std::size_t>(p)]->add(bed);
+			}
+			std::shared_ptr<Plant> plant;
+			if (stocked % 6 == 0) plant = std::make_shared<Cactus>("Cactus", 12.5);
+			else plant = std::make_shared<Rose>("Rose", 25.1);
+			const bool thirsty = p % stride == 0 && p / stride < thirstyPlots && i % (perBed * 10) == 0;
+			plant->setWaterLevel(thirsty ? kThirsty / 2 : 80);
+			if (thirsty && i % (perBed * 20) == 0) plant->setStage(LifecycleStage::Withering);
+			bed->add(plant);
+			lastPlant = plant;
+		}
+	}
+
+	const TraversalFilter thirsty = TraversalFilter::waterBelow(kThirsty);
+	const FilteredPreOrderTraversal thirstyPreOrder(thirsty);
+	const FilteredLevelOrderTraversal thirstyLevelOrder(thirsty);
+
+	// The first filtered scan computes the aggregates.
+	std::vector<ComponentTree::Handle> firstScan;
+	const double firstSeconds = timed(1, [&] { firstScan = inventory->collectNodes(thirstyPreOrder); });
+
+	std::size_t fullCount = 0;
+	const double fullIteratorSeconds = timed(passes, [&] {
+		fullCount = 0;
+		auto iterator = inventory->createIterator();
+		while (iterator->hasNext()) fullCount += thirsty.matches(*iterator->next());
+	});
+	std::size_t filteredCount = 0;
+	const double filteredIteratorSeconds = timed(passes, [&] {
+		filteredCount = 0;
+		auto iterator = inventory->createIterator(thirsty);
+		while (iterator->hasNext()) filteredCount += iterator->next() != nullptr;
+	});
+
+	std::vector<ComponentTree::Handle> fullPreOrder;
+	std::vector<ComponentTree::Handle> filteredPreOrder;
+	std::vector<ComponentTree::Handle> fullLevelOrder;
+	std::vector<ComponentTree::Handle> filteredLevelOrder;
+	const double fullHandleSeconds = timed(passes, [&] { fullPreOrder = keep(inventory->collectNodes(PreOrderTraversal()), thirsty); });
+	const double filteredHandleSeconds = timed(passes, [&] { filteredPreOrder = inventory->collectNodes(thirstyPreOrder); });
+	const double fullLevelSeconds = timed(passes, [&] { fullLevelOrder = keep(inventory->collectNodes(LevelOrderTraversal()), thirsty); });
+	const double filteredLevelSeconds = timed(passes, [&] { filteredLevelOrder = inventory->collectNodes(thirstyLevelOrder); });
+
+	// Withering plants in the first thirsty plot.
+	const ComponentTree& tree = ComponentTree::shared();
+	const ComponentTree::Handle plot = groups.front()->treeNode();
+	const TraversalFilter withering = TraversalFilter::inStage(LifecycleStage::Withering);
+	std::vector<ComponentTree::Handle> fullPlot;
+	std::vector<ComponentTree::Handle> filteredPlot;
+	const double fullPlotSeconds = timed(passes, [&] {
+		std::vector<ComponentTree::Handle> nodes;
+		PreOrderTraversal().traverse(tree, plot, nodes);
+		fullPlot = keep(nodes, withering);
+	});
+	const FilteredPreOrderTraversal witheringPreOrder(withering);
+	const double filteredPlotSeconds = timed(passes, [&] {
+		filteredPlot.clear();
+		witheringPreOrder.traverse(tree, plot, filteredPlot);
+	});
+
+	// One more thirsty plant: only its bed, plot and the plot's aggregates are rebuilt.
+	lastPlant->setWaterLevel(kThirsty / 2);
+	std::vector<ComponentTree::Handle> changedScan;
+	const double changedSeconds = timed(1, [&] { changedScan = inventory->collectNodes(thirstyPreOrder); });
+	const std::vector<ComponentTree::Handle> changedFull = keep(inventory->collectNodes(PreOrderTraversal()), thirsty);
+
+	std::cout << "plants=" << stocked << " plots=" << plots << " thirsty=" << fullPreOrder.size()
+		<< " withering in plot 0=" << fullPlot.size() << "\n";
+	std::cout << "first filtered scan after building:         " << firstSeconds * 1e3 << " ms\n";
+	std::cout << "first filtered scan after one plant changes: " << changedSeconds * 1e3 << " ms\n";
+	std::cout << "thirsty, snapshot iterator:  full " << fullIteratorSeconds * 1e3 << " ms, filtered "
+		<< filteredIteratorSeconds * 1e3 << " ms (" << fullIteratorSeconds / filteredIteratorSeconds << "x)\n";
+	std::cout << "thirsty, pre-order handles:  full " << fullHandleSeconds * 1e3 << " ms, filtered "
+		<< filteredHandleSeconds * 1e3 << " ms (" << fullHandleSeconds / filteredHandleSeconds << "x)\n";
+	std::cout << "thirsty, level-order handles: full " << fullLevelSeconds * 1e3 << " ms, filtered "
+		<< filteredLevelSeconds * 1e3 << " ms (" << fullLevelSeconds / filteredLevelSeconds << "x)\n";
+	std::cout << "withering in one plot:       full " << fullPlotSeconds * 1e6 << " us, filtered "
+		<< filteredPlotSeconds * 1e6 << " us (" << fullPlotSeconds / filteredPlotSeconds << "x)\n";
+
+	if (firstScan != fullPreOrder || filteredPreOrder != fullPreOrder || filteredLevelOrder != fullLevelOrder
+		|| filteredPlot != fullPlot || filteredCount != fullCount || fullCount != fullPreOrder.size()
+		|| changedScan != changedFull || changedFull.size() != fullPreOrder.size() + 1) {
+		std::cerr << "mismatch: a filtered scan differs from the full walk\n";
+		return 1;
+	}
+	std::cout << "same matches in the same order: yes\n";
+	return 0;
+}
@@ -0,0 +1,130 @@
+// Moves a bed of plants from one plot to another inside an inventory, first one
+// child at a time through Group::add() (each auto-move erases from the front of
+// the source's child vector) and then with Group::moveAll(). Checks both end
+// with the same children, the same cached aggregates and the same plant index
+// and predicate view contents. Then does the same between two inventories, where
+// every plant leaves one inventory's index and views and enters the other's.
+// Usage: GroupMoveBench [plants]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Scenario {
+	std::shared_ptr<Inventory> inventory;
+	std::shared_ptr<Group> from;
+	std::shared_ptr<Group> to;
+	std::shared_ptr<Group> greenhouse;
+	std::shared_ptr<Group> cacti;
+};
+
+Scenario build(long plants) {
+	Scenario scenario{std::make_shared<Inventory>(), std::make_shared<Group>("Bed A"), std::make_shared<Group>("Bed B"),
+		std::make_shared<Group>("Greenhouse"), nullptr};
+	scenario.inventory->add(scenario.greenhouse);
+	scenario.greenhouse->add(scenario.from);
+	scenario.inventory->add(scenario.to);
+	scenario.cacti = scenario.inventory->createView("Cacti", [](const Plant& plant) { return plant.getName() == "Cactus"; });
+	for (long i = 0; i < plants; ++i) {
+		if (i % 5 == 0) scenario.from->add(std::make_shared<Cactus>("Cactus", 12.0));
+		else scenario.from->add(std::make_shared<Rose>("Rose", 25.0));
+	}
+	return scenario;
+}
+
+// The destination bed sits in a second inventory with a view of its own.
+struct CrossScenario {
+	Scenario source;
+	std::shared_ptr<Inventory> inventory;
+	std::shared_ptr<Group> to;
+	std::shared_ptr<Group> cacti;
+};
+
+CrossScenario buildCross(long plants) {
+	CrossScenario scenario{build(plants), std::make_shared<Inventory>(), std::make_shared<Group>("Bed C"), nullptr};
+	scenario.inventory->add(scenario.to);
+	scenario.cacti = scenario.inventory->createView("Cacti", [](const Plant& plant) { return plant.getName() == "Cactus"; });
+	return scenario;
+}
+
+// Index entries and view sizes on both sides.
+std::vector<std::size_t> crossState(const CrossScenario& scenario) {
+	return {scenario.source.inventory->getPlantIndex().size(), scenario.source.cacti->memberCount(),
+		scenario.inventory->getPlantIndex().size(), scenario.cacti->memberCount(), scenario.to->ownedChildren().size()};
+}
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 50000;
+
+	Scenario oneByOne = build(plants);
+	const double addSeconds = timed([&] {
+		const auto children = oneByOne.from->ownedChildren();
+		for (const auto& child : children) oneByOne.to->add(child);
+	});
+
+	Scenario bulk = build(plants);
+	std::size_t moved = 0;
+	const double moveSeconds = timed([&] { moved = bulk.from->moveAll(bulk.to); });
+
+	std::cout << "plants=" << plants << " moved=" << moved << "\n";
+	std::cout << "add() one by one: " << addSeconds * 1e3 << " ms\n";
+	std::cout << "moveAll():        " << moveSeconds * 1e3 << " ms (" << addSeconds / moveSeconds << "x)\n";
+
+	// Ids differ between the two builds; compare the shapes through id offsets.
+	const uint64_t offset = bulk.to->ownedChildren().front()->getId() - oneByOne.to->ownedChildren().front()->getId();
+	bool same = oneByOne.to->ownedChildren().size() == bulk.to->ownedChildren().size() && oneByOne.from->ownedChildren().empty()
+		&& bulk.from->ownedChildren().empty();
+	for (std::size_t i = 0; same && i < bulk.to->ownedChildren().size(); ++i) {
+		same = bulk.to->ownedChildren()[i]->getId() - oneByOne.to->ownedChildren()[i]->getId() == offset;
+	}
+	// Cached totals of both beds and of the greenhouse above the source, and the view size.
+	const auto caches = [](const Scenario& scenario) {
+		return std::vector<int64_t>{scenario.to->getPriceCents(), static_cast<int64_t>(scenario.to->getPlantCount()),
+			static_cast<int64_t>(scenario.from->getPlantCount()),
+			static_cast<int64_t>(scenario.greenhouse->getPlantCount()),
+			static_cast<int64_t>(scenario.cacti->memberCount())};
+	};
+	if (!same || caches(oneByOne) != caches(bulk) || !bulk.inventory->findAvailable(LOW, FULL, "Cactus")) {
+		std::cerr << "mismatch: moveAll() left different children or caches\n";
+		return 1;
+	}
+	std::cout << "same result: yes\n";
+
+	CrossScenario crossOneByOne = buildCross(plants);
+	const double crossAddSeconds = timed([&] {
+		const auto children = crossOneByOne.source.from->ownedChildren();
+		for (const auto& child : children) crossOneByOne.to->add(child);
+	});
+	CrossScenario crossBulk = buildCross(plants);
+	const double crossMoveSeconds = timed([&] { crossBulk.source.from->moveAll(crossBulk.to); });
+	std::cout << "across inventories:\n";
+	std::cout << "add() one by one: " << crossAddSeconds * 1e3 << " ms\n";
+	std::cout << "moveAll():        " << crossMoveSeconds * 1e3 << " ms (" << crossAddSeconds / crossMoveSeconds << "x)\n";
+	const std::vector<std::size_t> expected{0, 0, static_cast<std::size_t>(plants),
+		static_cast<std::size_t>((plants + 4) / 5), static_cast<std::size_t>(plants)};
+	if (crossState(crossOneByOne) != expected || crossState(crossBulk) != expected
+		|| !crossBulk.inventory->findAvailable(LOW, FULL, "Cactus")) {
+		std::cerr << "mismatch: indexes or views differ after moving across inventories\n";
+		return 1;
+	}
+	std::cout << "same indexes and views: yes\n";
+	return 0;
+}
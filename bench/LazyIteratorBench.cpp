@@ -0,0 +1,97 @@
+// Walks a large inventory with the snapshot CompositeIterator and with the lazy
+// iterators, in pre-order and level order, both to the end and stopping after
+// the first few components, and checks both visit the same components in the
+// same order. A predicate view is added at the top level so view members are
+// walked too.
+// Usage: LazyIteratorBench [plants] [plots] [passes] [firstFew]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Patterns/Iterator/CompositeIterator.h"
+#include "../include/Patterns/Iterator/LevelOrderTraversal.h"
+#include "../include/Patterns/Iterator/PreOrderTraversal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+// Order-sensitive digest of the first 'limit' components of a snapshot walk.
+template <typename Traversal>
+uint64_t snapshotWalk(const Inventory& inventory, long limit) {
+	CompositeIterator iterator(inventory.getComponents(), std::make_unique<Traversal>());
+	uint64_t digest = 0;
+	for (long seen = 0; seen < limit && iterator.hasNext(); ++seen) digest = digest * 31 + iterator.next()->getId();
+	return digest;
+}
+
+template <typename Lazy>
+uint64_t lazyWalk(Lazy iterator, long limit) {
+	uint64_t digest = 0;
+	for (long seen = 0; seen < limit && iterator.hasNext(); ++seen) digest = digest * 31 + iterator.next()->getId();
+	return digest;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const int passes = argc > 3 ? std::atoi(argv[3]) : 3;
+	const long firstFew = argc > 4 ? std::atol(argv[4]) : 10;
+
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long i = 0; i < plots; ++i) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(i)));
+		inventory->add(groups.back());
+	}
+	for (long i = 0; i < plants; ++i) {
+		std::shared_ptr<InventoryComponent> plant;
+		if (i % 8 == 0) plant = std::make_shared<Cactus>("Cactus", 12.0);
+		else plant = std::make_shared<Rose>("Rose", 25.0);
+		groups[static_cast<std::size_t>(i % plots)]->add(plant);
+	}
+	inventory->add(inventory->createView("Cacti", [](const Plant& plant) { return plant.getName() == "Cactus"; }));
+
+	const long all = plants * 2 + plots + 1;
+	uint64_t expected[4] = {};
+	uint64_t actual[4] = {};
+	const double preSnapshot = timed(passes, [&] { expected[0] = snapshotWalk<PreOrderTraversal>(*inventory, all); });
+	const double preLazy = timed(passes, [&] { actual[0] = lazyWalk(inventory->walkPreOrder(), all); });
+	const double levelSnapshot = timed(passes, [&] { expected[1] = snapshotWalk<LevelOrderTraversal>(*inventory, all); });
+	const double levelLazy = timed(passes, [&] { actual[1] = lazyWalk(inventory->walkLevelOrder(), all); });
+	const double fewSnapshot = timed(passes, [&] { expected[2] = snapshotWalk<PreOrderTraversal>(*inventory, firstFew); });
+	const double fewLazy = timed(passes, [&] { actual[2] = lazyWalk(inventory->walkPreOrder(), firstFew); });
+	expected[3] = snapshotWalk<LevelOrderTraversal>(*inventory, firstFew);
+	actual[3] = lazyWalk(inventory->walkLevelOrder(), firstFew);
+
+	std::cout << "plants=" << plants << " plots=" << plots << " (plus a view of every cactus)\n";
+	std::cout << "pre-order,   full:   snapshot " << preSnapshot * 1e3 << " ms, lazy " << preLazy * 1e3 << " ms ("
+		<< preSnapshot / preLazy << "x)\n";
+	std::cout << "level order, full:   snapshot " << levelSnapshot * 1e3 << " ms, lazy " << levelLazy * 1e3 << " ms ("
+		<< levelSnapshot / levelLazy << "x)\n";
+	std::cout << "pre-order, first " << firstFew << ": snapshot " << fewSnapshot * 1e3 << " ms, lazy " << fewLazy * 1e6
+		<< " us\n";
+
+	for (int walk = 0; walk < 4; ++walk) {
+		if (expected[walk] != actual[walk]) {
+			std::cerr << "mismatch: lazy walk " << walk << " visited a different sequence\n";
+			return 1;
+		}
+	}
+	std::cout << "same order: yes\n";
+	return 0;
+}
@@ -0,0 +1,129 @@
+// Runs two bulk operations over a generated, deliberately skewed inventory (one
+// bed holds half the plants; the other plots shrink geometrically) with
+// ParallelWalk on 1, 2, 4, ... threads: a top-up sweep (forEach) and a health
+// audit (transformReduce summing prices as doubles and finding the sickest
+// plant). Checks the audit is bit-identical on every thread count and matches a
+// serial Iterator pass.
+// Usage: ParallelWalkBench [plants] [plots] [maxThreads] [passes]
+// Pass 10000000 plants for a 10^7-component tree (needs several GB of memory).
+#include "../include/Core/Inventory.h"
+#include "../include/Core/ParallelWalk.h"
+#include "../include/Core/ThreadPool.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Audit {
+	double price{0.0};
+	uint64_t plants{0};
+	int32_t minHealth{INT32_MAX};
+};
+
+Audit combine(Audit acc, const Audit& next) {
+	acc.price += next.price;
+	acc.plants += next.plants;
+	acc.minHealth = std::min(acc.minHealth, next.minHealth);
+	return acc;
+}
+
+Audit auditOf(const InventoryComponent& component) {
+	auto plant = dynamic_cast<const Plant*>(&component);
+	if (!plant) return Audit{};
+	return Audit{plant->getPrice(), 1, plant->getHealth()};
+}
+
+void topUp(InventoryComponent& component) {
+	if (auto plant = dynamic_cast<Plant*>(&component)) plant->setWaterLevel(std::min(100, plant->getWaterLevel() + 1));
+}
+
+bool identical(const Audit& a, const Audit& b) {
+	return std::memcmp(&a.price, &b.price, sizeof a.price) == 0 && a.plants == b.plants && a.minHealth == b.minHealth;
+}
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const unsigned maxThreads = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : std::max(1u, std::thread::hardware_concurrency());
+	const int passes = argc > 4 ? std::atoi(argv[4]) : 3;
+
+	// Half the plants in one bed, then each plot half the size of the previous one (at least one plant).
+	auto inventory = std::make_shared<Inventory>();
+	auto greenhouse = std::make_shared<Group>("Greenhouse");
+	inventory->add(greenhouse);
+	long placed = 0;
+	for (long p = 0; p < plots && placed < plants; ++p) {
+		auto plot = std::make_shared<Group>("Plot " + std::to_string(p));
+		if (p % 2) greenhouse->add(plot);
+		else inventory->add(plot);
+		const long size = p + 1 == plots ? plants - placed : std::max(1L, (plants - placed) / 2);
+		for (long i = 0; i < size; ++i, ++placed) {
+			if (placed % 6 == 0) plot->add(std::make_shared<Cactus>("Cactus", 12.5));
+			else plot->add(std::make_shared<Rose>("Rose", 25.1));
+		}
+	}
+
+	const auto planStart = std::chrono::steady_clock::now();
+	const ParallelWalk walk(*inventory);
+	const double planSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - planStart).count();
+
+	Audit serial;
+	const double iteratorSeconds = timed(passes, [&] {
+		serial = Audit{};
+		LazyPreOrderIterator iterator = inventory->walkPreOrder();
+		while (InventoryComponent* component = iterator.next()) serial = combine(serial, auditOf(*component));
+	});
+
+	std::cout << "plants=" << plants << " chunks=" << walk.chunkCount() << " plan " << planSeconds * 1e3
+		<< " ms, serial iterator audit " << iteratorSeconds * 1e3 << " ms\n";
+	std::cout << "threads   forEach ms   audit ms   audit speedup\n";
+	Audit first;
+	double oneThread = 0.0;
+	bool same = true;
+	std::vector<unsigned> threadCounts;
+	for (unsigned threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+	threadCounts.push_back(maxThreads);
+	for (unsigned threads : threadCounts) {
+		std::unique_ptr<ThreadPool> pool = threads > 1 ? std::make_unique<ThreadPool>(threads) : nullptr;
+		const double sweepSeconds = timed(passes, [&] { walk.forEach(pool.get(), topUp); });
+		Audit audit;
+		const double auditSeconds = timed(passes, [&] { audit = walk.transformReduce(pool.get(), Audit{}, combine, auditOf); });
+		if (threads == 1) {
+			first = audit;
+			oneThread = auditSeconds;
+		}
+		same = same && identical(audit, first);
+		std::printf("%7u %12.2f %10.2f %14.2fx\n", threads, sweepSeconds * 1e3, auditSeconds * 1e3, oneThread / auditSeconds);
+	}
+
+	// The serial pass sums in another order, so only the exact fields must agree with it.
+	if (!same || first.plants != serial.plants || first.minHealth != serial.minHealth
+		|| static_cast<uint64_t>(first.plants) != static_cast<uint64_t>(plants)) {
+		std::cerr << "mismatch: audit differs between thread counts or from the serial pass\n";
+		return 1;
+	}
+	std::cout << "audit identical on every thread count: yes\n";
+	return 0;
+}
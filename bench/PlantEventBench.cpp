@@ -0,0 +1,148 @@
+// Compares the two ways a busy phase reaches the NurserySupervisor: one
+// synchronous notify() -> update() callback per change (each plant attached to
+// the supervisor), against PlantEventBus records that are coalesced per plant
+// and delivered in one batch. Every plant changes 'rounds' times and ends up
+// thirsty. Each pass queues its commands on a fresh nursery; the first pass of
+// each kind warms up and is not timed. Then records the same changes from
+// several threads and checks that the published batch matches the serial one.
+// Usage: PlantEventBench [plants] [rounds] [threads] [passes]
+#include "../include/Core/Nursery.h"
+#include "../include/Components/Plant.h"
+#include "../include/Patterns/Observer/NurserySupervisor.h"
+#include "../include/Patterns/Observer/PlantEventBus.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Keeps a copy of every batch it is given.
+class BatchRecorder : public PlantEventObserver {
+public:
+	void update(const std::vector<PlantEvent>& events) override { batches.push_back(events); }
+	std::vector<std::vector<PlantEvent>> batches;
+};
+
+// Water level of every plant after change 'round' of 'rounds': falls from 40 to 20.
+int32_t waterAfter(int round, int rounds) { return 40 - 20 * (round + 1) / rounds; }
+
+// Records the changes of plants[begin, end) into 'bus'.
+void recordChanges(PlantEventBus& bus, const std::vector<std::shared_ptr<Plant>>& plants,
+	std::size_t begin, std::size_t end, int rounds) {
+	for (int round = 0; round < rounds; ++round) {
+		const int32_t before = round == 0 ? 40 : waterAfter(round - 1, rounds);
+		const int32_t after = waterAfter(round, rounds);
+		for (std::size_t i = begin; i < end; ++i) {
+			bus.record({plants[i].get(), plants[i]->getId(), before, after, PlantEvent::Field::WaterLevel});
+		}
+	}
+}
+
+bool sameEvents(const std::vector<PlantEvent>& a, const std::vector<PlantEvent>& b) {
+	if (a.size() != b.size()) return false;
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		if (a[i].plant != b[i].plant || a[i].plantId != b[i].plantId || a[i].field != b[i].field
+			|| a[i].before != b[i].before || a[i].after != b[i].after) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const std::size_t plantCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+	const int rounds = argc > 2 ? std::atoi(argv[2]) : 3;
+	const unsigned threads = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 4;
+	const int passes = argc > 4 ? std::atoi(argv[4]) : 3;
+
+	auto nursery = std::make_shared<Nursery>();
+	nursery->setCustomersPerDay(0);
+	const auto plants = nursery->stockPlants("Rose", plantCount);
+	for (const auto& plant : plants) plant->setWaterLevel(waterAfter(rounds - 1, rounds));
+
+	double callbackSeconds = 0.0;
+	double batchSeconds = 0.0;
+	std::size_t callbackCommands = 0;
+	std::size_t batchCommands = 0;
+	PlantEventBus bus;
+	for (int pass = 0; pass <= passes; ++pass) {
+		// Per-change callbacks: every notify() runs update() on the attached supervisor.
+		auto sink = std::make_shared<Nursery>();
+		auto attached = std::make_shared<NurserySupervisor>(sink);
+		for (const auto& plant : plants) plant->attach(attached);
+		const double callbackPass = timed([&] {
+			for (int round = 0; round < rounds; ++round) {
+				for (const auto& plant : plants) plant->notify();
+			}
+		});
+		for (const auto& plant : plants) plant->detach(attached);
+		callbackCommands = sink->pendingRequests();
+
+		// Batched: one record per change, one update() per publish.
+		sink = std::make_shared<Nursery>();
+		auto subscribed = std::make_shared<NurserySupervisor>(sink);
+		for (const auto& plant : plants) subscribed->watch(*plant);
+		bus.subscribe(subscribed);
+		const double batchPass = timed([&] {
+			recordChanges(bus, plants, 0, plants.size(), rounds);
+			bus.publish();
+		});
+		bus.unsubscribe(subscribed);
+		batchCommands = sink->pendingRequests();
+
+		if (pass == 0) continue;
+		callbackSeconds += callbackPass / passes;
+		batchSeconds += batchPass / passes;
+	}
+
+	// The same changes recorded serially and from 'threads' threads give the same batch.
+	PlantEventBus serialBus;
+	PlantEventBus parallelBus;
+	auto serialBatches = std::make_shared<BatchRecorder>();
+	auto parallelBatches = std::make_shared<BatchRecorder>();
+	serialBus.subscribe(serialBatches);
+	parallelBus.subscribe(parallelBatches);
+	recordChanges(serialBus, plants, 0, plants.size(), rounds);
+	serialBus.publish();
+	std::vector<std::thread> producers;
+	// Slices interleave the id order, so the threads' buffers have to be merged, not concatenated.
+	for (unsigned t = 0; t < threads; ++t) {
+		producers.emplace_back([&, t] {
+			for (std::size_t i = t; i < plants.size(); i += threads) recordChanges(parallelBus, plants, i, i + 1, rounds);
+		});
+	}
+	for (auto& producer : producers) producer.join();
+	const double publishSeconds = timed([&] { parallelBus.publish(); });
+
+	std::cout << "plants=" << plants.size() << " changes per plant=" << rounds << " threads=" << threads << "\n";
+	std::cout << "per-change callbacks: " << callbackSeconds * 1e3 << " ms/pass, " << callbackCommands << " commands queued\n";
+	std::cout << "batched events:       " << batchSeconds * 1e3 << " ms/pass (" << callbackSeconds / batchSeconds << "x), "
+		<< batchCommands << " commands queued, " << bus.recordedCount() << " records -> " << bus.deliveredCount()
+		<< " events\n";
+	std::cout << "publish of " << parallelBus.recordedCount() << " records from " << threads << " threads: "
+		<< publishSeconds * 1e3 << " ms\n";
+
+	const bool same = serialBatches->batches.size() == 1 && parallelBatches->batches.size() == 1
+		&& sameEvents(serialBatches->batches[0], parallelBatches->batches[0]);
+	if (!same || batchCommands != plants.size() || callbackCommands != plants.size() * static_cast<std::size_t>(rounds)
+		|| bus.deliveredCount() != plants.size() * static_cast<std::size_t>(passes + 1)) {
+		std::cerr << "mismatch: batched delivery differs from per-change callbacks or from the serial batch\n";
+		return 1;
+	}
+	std::cout << "one command per plant, same batch from any thread count: yes\n";
+	return 0;
+}
@@ -0,0 +1,118 @@
+// Sells plants to a stream of customer orders two ways on identical inventories:
+// the old pre-order iterator scan for the first match, and
+// FulfillCustomerCommand, which asks the Inventory's PlantIndex. A share of the
+// orders asks for something nobody stocks, which the scan can only learn by
+// visiting every plant. Checks both ways fulfil the same number of orders.
+// Usage: PlantIndexBench [plants] [plots] [orders]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+#include "../include/Actors/Customer.h"
+#include "../include/Patterns/Builder/PlantSpecification.h"
+#include "../include/Patterns/Command/FulfillCustomerCommand.h"
+#include "../include/Patterns/Iterator/Iterator.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<Inventory> build(long plants, long plots) {
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long i = 0; i < plots; ++i) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(i)));
+		inventory->add(groups.back());
+	}
+	for (long i = 0; i < plants; ++i) {
+		std::shared_ptr<InventoryComponent> plant;
+		if (i % 4 == 0) plant = std::make_shared<Cactus>("Cactus", 12.0);
+		else plant = std::make_shared<Rose>("Rose", 25.0);
+		groups[static_cast<std::size_t>(i % plots)]->add(plant);
+	}
+	return inventory;
+}
+
+// Fixed order mix: cacti, roses, either, and one nobody stocks (no plant needs only shade).
+PlantSpecification order(long index) {
+	PlantSpecification spec;
+	spec.requestType = PURCHASE;
+	switch (index % 4) {
+	case 0: spec.waterReq = LOW; spec.sunReq = FULL; spec.explicitName = "Cactus"; break;
+	case 1: spec.waterReq = HIGH; spec.sunReq = PARTIAL; break;
+	case 2: spec.waterReq = HIGH; spec.sunReq = FULL; break;
+	default: spec.waterReq = HIGH; spec.sunReq = SHADE; break;
+	}
+	return spec;
+}
+
+// What FulfillCustomerCommand did before the index: walk until the first match.
+bool sellByScan(Inventory& inventory, const PlantSpecification& spec, Customer& customer) {
+	auto iterator = inventory.createIterator();
+	while (iterator->hasNext()) {
+		auto plant = std::dynamic_pointer_cast<Plant>(iterator->next());
+		if (!plant || plant->getStage() == LifecycleStage::Withered || plant->getWaterRequirement() > spec.waterReq
+			|| plant->getSunRequirement() > spec.sunReq
+			|| (!spec.explicitName.empty() && plant->getName() != spec.explicitName)) {
+			continue;
+		}
+		if (auto owner = plant->getOwner()) owner->remove(plant);
+		else inventory.remove(plant);
+		customer.receive(plant);
+		return true;
+	}
+	return false;
+}
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const long orders = argc > 3 ? std::atol(argv[3]) : 40;
+
+	auto scanned = build(plants, plots);
+	auto scanBuyer = std::make_shared<Customer>();
+	long scanSold = 0;
+	const double scanSeconds = timed([&] {
+		for (long i = 0; i < orders; ++i) scanSold += sellByScan(*scanned, order(i), *scanBuyer);
+	});
+
+	std::shared_ptr<Inventory> indexed;
+	const double buildSeconds = timed([&] { indexed = build(plants, plots); });
+	auto indexBuyer = std::make_shared<Customer>();
+	long indexSold = 0;
+	const double indexSeconds = timed([&] {
+		for (long i = 0; i < orders; ++i) {
+			FulfillCustomerCommand command(std::make_unique<PlantSpecification>(order(i)), indexed, indexBuyer);
+			command.execute();
+			indexSold += command.getStatus() == Command::Status::Completed;
+		}
+	});
+
+	std::cout << "plants=" << plants << " plots=" << plots << " orders=" << orders
+		<< " index entries=" << indexed->getPlantIndex().size() << "\n";
+	std::cout << "iterator scan:  " << scanSeconds / orders * 1e6 << " us/order\n";
+	std::cout << "plant index:    " << indexSeconds / orders * 1e6 << " us/order ("
+		<< scanSeconds / indexSeconds << "x faster)\n";
+	std::cout << "stock (indexed) " << buildSeconds * 1e3 << " ms for " << plants << " plants\n";
+
+	if (scanSold != indexSold) {
+		std::cerr << "mismatch: scan sold " << scanSold << ", index sold " << indexSold << "\n";
+		return 1;
+	}
+	std::cout << "same orders fulfilled: yes (" << indexSold << " of " << orders << ")\n";
+	return 0;
+}
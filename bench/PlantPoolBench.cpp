@@ -0,0 +1,105 @@
+// Stocks a bed of seedlings two ways, one std::make_shared<Rose> per plant (the
+// old factory path) and RoseFactory::createPlants(), counting every heap
+// allocation made while stocking (this binary replaces the global operator new).
+// Then churns the pooled bed: sells a share of it and restocks one plant at a
+// time, which the pool serves from its free list. Reports the pool's hit rate
+// and bytes per plant.
+// Usage: PlantPoolBench [plants] [churnRounds]
+#include "../include/Components/Rose.h"
+#include "../include/Core/SlabPool.h"
+#include "../include/Patterns/Factory/RoseFactory.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> heapAllocations{0};
+
+void* countedAllocate(std::size_t bytes, std::size_t alignment) {
+	heapAllocations.fetch_add(1, std::memory_order_relaxed);
+	void* block = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__
+		? std::malloc(bytes ? bytes : 1)
+		: std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+	if (!block) throw std::bad_alloc();
+	return block;
+}
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+void* operator new(std::size_t bytes) { return countedAllocate(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t bytes, std::align_val_t alignment) { return countedAllocate(bytes, static_cast<std::size_t>(alignment)); }
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete(void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { std::free(block); }
+
+int main(int argc, char** argv) {
+	const std::size_t plants = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 100000;
+	const int rounds = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	// Separate stores so each way pays for its own column growth.
+	auto plainStore = std::make_shared<PlantStore>();
+	auto pooledStore = std::make_shared<PlantStore>();
+	RoseFactory factory(pooledStore);
+
+	std::vector<std::shared_ptr<Plant>> plain;
+	plain.reserve(plants);
+	uint64_t before = heapAllocations.load();
+	const double plainSeconds = timed([&] {
+		for (std::size_t i = 0; i < plants; ++i) plain.push_back(std::make_shared<Rose>("Rose", 25.0, plainStore));
+	});
+	const uint64_t plainAllocations = heapAllocations.load() - before;
+
+	std::vector<std::shared_ptr<Plant>> pooled;
+	before = heapAllocations.load();
+	const double pooledSeconds = timed([&] { pooled = factory.createPlants(plants); });
+	const uint64_t pooledAllocations = heapAllocations.load() - before;
+	const SlabPool::Stats stocked = RoseFactory::pool().stats();
+
+	// Churn: sell every third plant, restock the same number one at a time.
+	uint64_t churnAllocations = 0;
+	const double churnSeconds = timed([&] {
+		for (int round = 0; round < rounds; ++round) {
+			for (std::size_t i = static_cast<std::size_t>(round) % 3; i < pooled.size(); i += 3) pooled[i].reset();
+			before = heapAllocations.load();
+			for (std::size_t i = static_cast<std::size_t>(round) % 3; i < pooled.size(); i += 3) pooled[i] = factory.createPlant();
+			churnAllocations += heapAllocations.load() - before;
+		}
+	});
+	const SlabPool::Stats churned = RoseFactory::pool().stats();
+
+	const uint64_t served = churned.allocations - churned.fallbacks;
+	std::cout << "plants=" << plants << "\n";
+	std::cout << "make_shared loop:  " << plainSeconds * 1e3 << " ms, " << plainAllocations << " heap allocations\n";
+	std::cout << "createPlants():    " << pooledSeconds * 1e3 << " ms, " << pooledAllocations << " heap allocations ("
+		<< stocked.slabs << " slabs)\n";
+	std::cout << "churn x" << rounds << ":         " << churnSeconds * 1e3 << " ms, " << churnAllocations
+		<< " heap allocations\n";
+	std::cout << "pool: " << churned.allocations << " allocations, " << churned.reused << " from the free list ("
+		<< 100.0 * static_cast<double>(churned.reused) / static_cast<double>(churned.allocations) << "%), "
+		<< churned.carved << " carved, " << churned.fallbacks << " fallbacks (hit rate "
+		<< 100.0 * static_cast<double>(served) / static_cast<double>(churned.allocations) << "%)\n";
+	std::cout << "bytes per plant: " << churned.blockSize << " B block (Rose + control block; sizeof(Rose) = "
+		<< sizeof(Rose) << "), " << static_cast<double>(churned.bytesReserved) / static_cast<double>(churned.liveBlocks)
+		<< " B of slab per live plant\n";
+
+	if (pooled.size() != plants || churned.liveBlocks != plants || churned.fallbacks != 0 || churned.slabs != stocked.slabs) {
+		std::cerr << "mismatch: the pool did not recycle the churned plants\n";
+		return 1;
+	}
+	std::cout << "churn served without new slabs: yes\n";
+	return 0;
+}
@@ -0,0 +1,75 @@
+// Compares the object-per-plant daily tick (virtual PlantState call per Plant)
+// with the batched PlantStore kernel. Usage: PlantStoreBench [plants] [days]
+#include "../include/Components/PlantStore.h"
+#include "../include/Components/Rose.h"
+#include "../include/Components/Cactus.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::vector<std::shared_ptr<Plant>> stock(const std::shared_ptr<PlantStore>& store, std::size_t count) {
+	std::vector<std::shared_ptr<Plant>> plants;
+	plants.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		if (i % 3 == 0) plants.push_back(std::make_shared<Cactus>("Cactus", 15.0, store));
+		else plants.push_back(std::make_shared<Rose>("Rose", 25.0, store));
+	}
+	return plants;
+}
+
+uint64_t checksum(const std::vector<std::shared_ptr<Plant>>& plants) {
+	uint64_t sum = 0;
+	for (const auto& plant : plants) {
+		sum = sum * 31 + static_cast<uint64_t>(plant->getAge());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getHealth());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getWaterLevel());
+		sum = sum * 31 + static_cast<uint64_t>(plant->getStage());
+	}
+	return sum;
+}
+
+double seconds(std::chrono::steady_clock::duration elapsed) {
+	return std::chrono::duration<double>(elapsed).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const std::size_t plantCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+	const int days = argc > 2 ? std::atoi(argv[2]) : 60;
+
+	auto objectStore = std::make_shared<PlantStore>();
+	auto columnStore = std::make_shared<PlantStore>();
+	const auto objectPlants = stock(objectStore, plantCount);
+	const auto columnPlants = stock(columnStore, plantCount);
+
+	auto start = std::chrono::steady_clock::now();
+	for (int day = 0; day < days; ++day) {
+		for (const auto& plant : objectPlants) plant->performDailyActivity();
+	}
+	const double objectSeconds = seconds(std::chrono::steady_clock::now() - start);
+
+	start = std::chrono::steady_clock::now();
+	for (int day = 0; day < days; ++day) columnStore->tick();
+	const double columnSeconds = seconds(std::chrono::steady_clock::now() - start);
+
+	const double plantDays = static_cast<double>(plantCount) * days;
+	std::cout << "plants=" << plantCount << " days=" << days << "\n";
+	std::cout << "object-per-plant: " << plantDays / objectSeconds << " plant-ticks/s ("
+	          << days / objectSeconds << " days/s)\n";
+	std::cout << "columnar store:   " << plantDays / columnSeconds << " plant-ticks/s ("
+	          << days / columnSeconds << " days/s)\n";
+	std::cout << "speedup:          " << objectSeconds / columnSeconds << "x\n";
+
+	if (checksum(objectPlants) != checksum(columnPlants)) {
+		std::cerr << "mismatch: columnar tick diverged from the object path\n";
+		return 1;
+	}
+	return 0;
+}
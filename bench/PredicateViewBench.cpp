@@ -0,0 +1,100 @@
+// Compares a hand-maintained reference view of all cacti (weak_ptrs, members()
+// copying a vector of shared_ptrs, linear membership tests) with the predicate
+// view Inventory::createView() maintains, iterated in place with forEachMember()
+// and tested with hasMember(). Then sells a share of the cacti and checks the
+// predicate view dropped them without any pruning. The hand-kept view's add()
+// scans its references for duplicates, so filling it is quadratic; keep the
+// plant count moderate.
+// Usage: PredicateViewBench [plants] [plots] [passes] [probes]
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 100000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 256;
+	const int passes = argc > 3 ? std::atoi(argv[3]) : 5;
+	const long probes = argc > 4 ? std::atol(argv[4]) : 200;
+
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long i = 0; i < plots; ++i) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(i)));
+		inventory->add(groups.back());
+	}
+	auto manual = std::make_shared<Group>("Cacti (by hand)", false);
+	auto view = inventory->createView("Cacti", [](const Plant& plant) { return plant.getName() == "Cactus"; });
+	std::vector<std::shared_ptr<InventoryComponent>> cacti;
+	for (long i = 0; i < plants; ++i) {
+		std::shared_ptr<InventoryComponent> plant;
+		if (i % 4 == 0) {
+			plant = std::make_shared<Cactus>("Cactus", 12.0);
+			manual->add(plant);
+			cacti.push_back(plant);
+		} else {
+			plant = std::make_shared<Rose>("Rose", 25.0);
+		}
+		groups[static_cast<std::size_t>(i % plots)]->add(plant);
+	}
+
+	uint64_t manualSum = 0;
+	uint64_t viewSum = 0;
+	const double manualSeconds = timed(passes, [&] {
+		manualSum = 0;
+		for (const auto& member : manual->members()) manualSum += member->getId();
+	});
+	const double viewSeconds = timed(passes, [&] {
+		viewSum = 0;
+		view->forEachMember([&viewSum](const InventoryComponent& member) { viewSum += member.getId(); });
+	});
+
+	// Probe the last cacti stocked: the worst case for a linear scan.
+	long manualHits = 0;
+	long viewHits = 0;
+	const double manualProbeSeconds = timed(1, [&] {
+		for (long i = 0; i < probes; ++i) manualHits += manual->hasMember(*cacti[cacti.size() - 1 - static_cast<std::size_t>(i)]);
+	});
+	const double viewProbeSeconds = timed(1, [&] {
+		for (long i = 0; i < probes; ++i) viewHits += view->hasMember(*cacti[cacti.size() - 1 - static_cast<std::size_t>(i)]);
+	});
+
+	// Sell every other cactus: the predicate view follows, the manual one keeps expired entries.
+	std::size_t sold = 0;
+	for (std::size_t i = 0; i < cacti.size(); i += 2, ++sold) {
+		if (auto owner = cacti[i]->getOwner()) owner->remove(cacti[i]);
+	}
+	const std::size_t remaining = cacti.size() - sold;
+
+	std::cout << "plants=" << plants << " plots=" << plots << " cacti=" << cacti.size() << "\n";
+	std::cout << "members() copy:     " << manualSeconds * 1e3 << " ms/pass\n";
+	std::cout << "forEachMember():    " << viewSeconds * 1e3 << " ms/pass (" << manualSeconds / viewSeconds << "x)\n";
+	std::cout << "hasMember, manual:  " << manualProbeSeconds / probes * 1e6 << " us/probe\n";
+	std::cout << "hasMember, view:    " << viewProbeSeconds / probes * 1e6 << " us/probe\n";
+	std::cout << "after selling " << sold << ": view holds " << view->memberCount() << "\n";
+
+	if (manualSum != viewSum || manualHits != probes || viewHits != probes || view->memberCount() != remaining) {
+		std::cerr << "mismatch: predicate view disagrees with the hand-kept one\n";
+		return 1;
+	}
+	std::cout << "same members: yes\n";
+	return 0;
+}
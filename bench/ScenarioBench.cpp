@@ -0,0 +1,239 @@
+// End-to-end load scenario: N plants spread over M nested plots, K customers per
+// day, D simulated days with a save after every day. Reports simulated days per
+// second, p50/p99 latency of each day phase, queue-wait latency per command type,
+// staff utilization, routing outcomes and peak RSS, and writes them as JSON so
+// runs can be compared across versions.
+// Usage: ScenarioBench [--plants N] [--groups M] [--customers K] [--days D]
+//                      [--threads T] [--seed S] [--gardeners G] [--gardener-capacity U]
+//                      [--out FILE] [--save-file FILE]
+#include "../include/Core/Nursery.h"
+#include "../include/Core/Inventory.h"
+#include "../include/Core/SaveSystem.h"
+#include "../include/Core/Json.h"
+#include "../include/Actors/Gardener.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Plant.h"
+#include "../include/Patterns/Iterator/LazyPreOrderIterator.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Config {
+	long plants = 100000;
+	long groups = 256;
+	int customers = 20;
+	int days = 20;
+	unsigned threads = 1;
+	uint64_t seed = 42;
+	int gardeners = 2;
+	std::size_t gardenerCapacity = 10000; // work units per gardener per day; 0 = unlimited
+	std::string out = "Report/scenario_bench.json";
+	std::string saveFile = "Report/scenario_save.json";
+};
+
+// Plots form a 4-ary tree: plot i > 0 is nested inside plot (i - 1) / 4.
+constexpr long kPlotFanout = 4;
+
+enum PhaseIndex { Tick, Spawn, Process, Save, kPhaseCount };
+constexpr std::array<const char*, kPhaseCount> kPhaseNames{{"tick", "spawnCustomer", "processRequestQueue", "save"}};
+
+bool parse(int argc, char** argv, Config& config) {
+	for (int i = 1; i + 1 < argc; i += 2) {
+		const std::string flag = argv[i];
+		const char* value = argv[i + 1];
+		if (flag == "--plants") config.plants = std::atol(value);
+		else if (flag == "--groups") config.groups = std::atol(value);
+		else if (flag == "--customers") config.customers = std::atoi(value);
+		else if (flag == "--days") config.days = std::atoi(value);
+		else if (flag == "--threads") config.threads = static_cast<unsigned>(std::atoi(value));
+		else if (flag == "--seed") config.seed = std::strtoull(value, nullptr, 10);
+		else if (flag == "--gardeners") config.gardeners = std::atoi(value);
+		else if (flag == "--gardener-capacity") config.gardenerCapacity = std::strtoull(value, nullptr, 10);
+		else if (flag == "--out") config.out = value;
+		else if (flag == "--save-file") config.saveFile = value;
+		else return false;
+	}
+	return argc % 2 == 1 && config.plants >= 0 && config.groups >= 0 && config.days > 0;
+}
+
+std::shared_ptr<Nursery> build(const Config& config) {
+	auto nursery = std::make_shared<Nursery>();
+	nursery->setSeed(config.seed);
+	nursery->setThreadCount(config.threads);
+	nursery->setCustomersPerDay(config.customers);
+	for (int i = 1; i < config.gardeners; ++i) nursery->hireStaff(std::make_shared<Gardener>()); // one comes with the nursery
+	for (const auto& member : nursery->getStaffRouter().staffStats()) {
+		if (member.staff->canHandle(Command::Kind::WaterPlant)) {
+			member.staff->setDailyCapacity(config.gardenerCapacity ? config.gardenerCapacity : Staff::kUnlimited);
+		}
+	}
+
+	std::vector<std::shared_ptr<Group>> plots;
+	plots.reserve(static_cast<std::size_t>(config.groups));
+	for (long i = 0; i < config.groups; ++i) {
+		auto parent = i == 0 ? nullptr : plots[static_cast<std::size_t>((i - 1) / kPlotFanout)];
+		plots.push_back(nursery->addPlot("Plot " + std::to_string(i), parent));
+	}
+	for (long i = 0; i < config.plants; ++i) {
+		auto plot = plots.empty() ? nullptr : plots[static_cast<std::size_t>(i % config.groups)];
+		nursery->stockPlant(i % 3 == 0 ? "Cactus" : "Rose", plot);
+	}
+	return nursery;
+}
+
+long countPlants(Nursery& nursery) {
+	long count = 0;
+	LazyPreOrderIterator iterator = nursery.getInventory()->walkPreOrder();
+	while (InventoryComponent* component = iterator.next()) count += dynamic_cast<Plant*>(component) != nullptr;
+	return count;
+}
+
+double percentile(std::vector<double> samples, double q) {
+	if (samples.empty()) return 0.0;
+	std::sort(samples.begin(), samples.end());
+	return samples[static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1) + 0.5)];
+}
+
+double mean(const std::vector<double>& samples) {
+	double total = 0.0;
+	for (double sample : samples) total += sample;
+	return samples.empty() ? 0.0 : total / static_cast<double>(samples.size());
+}
+
+long peakRssKb() {
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss; // kilobytes on Linux
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	Config config;
+	if (!parse(argc, argv, config)) {
+		std::cerr << "usage: ScenarioBench [--plants N] [--groups M] [--customers K] [--days D] [--threads T]"
+			" [--seed S] [--gardeners G] [--gardener-capacity U] [--out FILE] [--save-file FILE]\n";
+		return 2;
+	}
+
+	using Clock = std::chrono::steady_clock;
+	const auto setupStart = Clock::now();
+	auto nursery = build(config);
+	const double setupSeconds = std::chrono::duration<double>(Clock::now() - setupStart).count();
+	const long plantsAtStart = countPlants(*nursery);
+
+	std::array<std::vector<double>, kPhaseCount> samples; // milliseconds, one per day
+	for (auto& phase : samples) phase.reserve(static_cast<std::size_t>(config.days));
+	nursery->setPhaseTimer([&samples](Nursery::Phase phase, std::chrono::nanoseconds elapsed) {
+		samples[static_cast<std::size_t>(phase)].push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+	});
+	static_assert(static_cast<int>(Nursery::Phase::Tick) == Tick
+		&& static_cast<int>(Nursery::Phase::SpawnCustomers) == Spawn
+		&& static_cast<int>(Nursery::Phase::ProcessRequests) == Process, "phase indices must line up");
+
+	SaveSystem saves;
+	const auto runStart = Clock::now();
+	for (int day = 0; day < config.days; ++day) {
+		nursery->defragmentTree(); // no handles are held between days
+		nursery->runSimulation(1);
+		const auto saveStart = Clock::now();
+		saves.save(nursery, config.saveFile);
+		samples[Save].push_back(std::chrono::duration<double, std::milli>(Clock::now() - saveStart).count());
+	}
+	const double runSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+	const long plantsAtEnd = countPlants(*nursery);
+	const long rss = peakRssKb();
+
+	std::string json = "{\"benchmark\":\"ScenarioBench\",\"config\":{";
+	json += "\"plants\":" + std::to_string(config.plants) + ",\"groups\":" + std::to_string(config.groups);
+	json += ",\"customersPerDay\":" + std::to_string(config.customers) + ",\"days\":" + std::to_string(config.days);
+	json += ",\"threads\":" + std::to_string(config.threads) + ",\"seed\":" + std::to_string(config.seed);
+	json += ",\"gardeners\":" + std::to_string(config.gardeners);
+	json += ",\"gardenerCapacity\":" + std::to_string(config.gardenerCapacity) + "}";
+	json += ",\"setupSeconds\":" + Json::number(setupSeconds) + ",\"runSeconds\":" + Json::number(runSeconds);
+	json += ",\"daysPerSecond\":" + Json::number(config.days / runSeconds) + ",\"phases\":{";
+	for (int phase = 0; phase < kPhaseCount; ++phase) {
+		if (phase) json += ',';
+		json += Json::quote(kPhaseNames[phase]) + ":{\"p50Ms\":" + Json::number(percentile(samples[phase], 0.50));
+		json += ",\"p99Ms\":" + Json::number(percentile(samples[phase], 0.99));
+		json += ",\"meanMs\":" + Json::number(mean(samples[phase])) + "}";
+	}
+	json += "},\"queueWait\":{";
+	const auto& waits = nursery->getRequestQueue().waitStats();
+	for (std::size_t i = 0; i < waits.size(); ++i) {
+		const auto& wait = waits[i];
+		if (i) json += ',';
+		json += Json::quote(wait.typeName) + ":{\"count\":" + std::to_string(wait.count);
+		json += ",\"meanUs\":" + Json::number(wait.meanNs() / 1e3);
+		json += ",\"p50Us\":" + Json::number(static_cast<double>(wait.percentileNs(0.50)) / 1e3);
+		json += ",\"p99Us\":" + Json::number(static_cast<double>(wait.percentileNs(0.99)) / 1e3);
+		json += ",\"maxUs\":" + Json::number(static_cast<double>(wait.maxNs) / 1e3);
+		json += ",\"daysLate\":" + std::to_string(wait.daysLate) + "}";
+	}
+	json += "},\"staff\":[";
+	const auto& router = nursery->getStaffRouter();
+	for (std::size_t i = 0; i < router.staffStats().size(); ++i) {
+		const auto& member = router.staffStats()[i];
+		if (i) json += ',';
+		json += "{\"role\":" + Json::quote(member.staff->roleName()) + ",\"commands\":" + std::to_string(member.commands);
+		json += ",\"workUnits\":" + std::to_string(member.workUnits);
+		json += ",\"utilization\":" + Json::number(member.utilization()) + "}";
+	}
+	json += "],\"routing\":{";
+	for (std::size_t kind = 0; kind < Command::kKindCount; ++kind) {
+		const auto& routed = router.kindStats(static_cast<Command::Kind>(kind));
+		if (kind) json += ',';
+		json += Json::quote(Command::kindName(static_cast<Command::Kind>(kind)));
+		json += ":{\"performed\":" + std::to_string(routed.performed) + ",\"deferred\":" + std::to_string(routed.deferred);
+		json += ",\"dropped\":" + std::to_string(routed.dropped) + "}";
+	}
+	json += "},\"coalescedWaterings\":" + std::to_string(nursery->getCoalescedRequestCount());
+	json += ",\"peakRssKb\":" + std::to_string(rss);
+	json += ",\"plantsAtStart\":" + std::to_string(plantsAtStart) + ",\"plantsAtEnd\":" + std::to_string(plantsAtEnd) + "}\n";
+
+	std::ofstream out(config.out, std::ios::trunc);
+	if (!out || !(out << json)) {
+		std::cerr << "cannot write " << config.out << "\n";
+		return 1;
+	}
+
+	std::printf("plants=%ld groups=%ld customers/day=%d days=%d threads=%u\n", config.plants, config.groups,
+		config.customers, config.days, config.threads);
+	std::printf("setup %.3f s, %.2f days/s, peak RSS %ld KiB, plants %ld -> %ld\n", setupSeconds,
+		config.days / runSeconds, rss, plantsAtStart, plantsAtEnd);
+	for (int phase = 0; phase < kPhaseCount; ++phase) {
+		std::printf("  %-20s p50 %9.3f ms  p99 %9.3f ms\n", kPhaseNames[phase], percentile(samples[phase], 0.50),
+			percentile(samples[phase], 0.99));
+	}
+	std::printf("  waterings coalesced: %llu\n", static_cast<unsigned long long>(nursery->getCoalescedRequestCount()));
+	for (const auto& wait : nursery->getRequestQueue().waitStats()) {
+		std::printf("  queue wait %-22s n=%-8llu mean %9.1f us  p99 <= %9.1f us\n", wait.typeName,
+			static_cast<unsigned long long>(wait.count), wait.meanNs() / 1e3, static_cast<double>(wait.percentileNs(0.99)) / 1e3);
+	}
+	for (const auto& member : nursery->getStaffRouter().staffStats()) {
+		std::printf("  staff %-9s commands=%-8llu units=%-9llu utilization %5.1f%%\n", member.staff->roleName(),
+			static_cast<unsigned long long>(member.commands), static_cast<unsigned long long>(member.workUnits),
+			member.utilization() * 100.0);
+	}
+	for (std::size_t kind = 0; kind < Command::kKindCount; ++kind) {
+		const auto& routed = nursery->getStaffRouter().kindStats(static_cast<Command::Kind>(kind));
+		std::printf("  routed %-16s performed=%-8llu deferred=%-6llu dropped=%llu\n",
+			Command::kindName(static_cast<Command::Kind>(kind)), static_cast<unsigned long long>(routed.performed),
+			static_cast<unsigned long long>(routed.deferred), static_cast<unsigned long long>(routed.dropped));
+	}
+	std::printf("results written to %s\n", config.out.c_str());
+	return 0;
+}
@@ -0,0 +1,129 @@
+// Takes an inventory snapshot, changes a few hundred plants (waterings and moves
+// between plots), then snapshots again with the same SnapshotRecorder (sharing
+// unchanged subtrees) and with a fresh one (recording everything, like a full
+// deep copy). Reports time, heap bytes allocated and nodes recorded for each,
+// checks that both give the same document and that the first snapshot did not
+// change. A day tick then changes every plant; the capture after it is reported too.
+// Usage: SnapshotBench [plots] [plantsPerPlot] [changes]
+#include "../include/Core/Nursery.h"
+#include "../include/Core/Inventory.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Plant.h"
+#include "../include/Patterns/Memento/InventorySnapshot.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> heapBytes{0};
+
+template <typename Fn>
+double timed(Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string json(const InventorySnapshot& snapshot) {
+	std::string roots;
+	std::string components;
+	std::string groups;
+	snapshot.appendJson(roots, components, groups);
+	return roots + "|" + components + "|" + groups;
+}
+
+struct Capture {
+	std::shared_ptr<const InventorySnapshot> snapshot;
+	double seconds{0.0};
+	uint64_t bytes{0};
+	SnapshotRecorder::Stats stats;
+};
+
+Capture capture(SnapshotRecorder& recorder, const Inventory& inventory) {
+	Capture result;
+	const uint64_t before = heapBytes.load();
+	result.seconds = timed([&] { result.snapshot = recorder.capture(inventory); });
+	result.bytes = heapBytes.load() - before;
+	result.stats = recorder.lastCapture();
+	return result;
+}
+
+void report(const char* label, const Capture& run) {
+	std::cout << label << run.seconds * 1e3 << " ms, " << static_cast<double>(run.bytes) / (1 << 20) << " MiB allocated, "
+		<< run.stats.visited << " visited, " << run.stats.recorded << " recorded, " << run.stats.shared << " shared\n";
+}
+
+} // namespace
+
+void* operator new(std::size_t bytes) {
+	heapBytes.fetch_add(bytes, std::memory_order_relaxed);
+	if (void* block = std::malloc(bytes ? bytes : 1)) return block;
+	throw std::bad_alloc();
+}
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+
+int main(int argc, char** argv) {
+	const int plots = argc > 1 ? std::atoi(argv[1]) : 200;
+	const int perPlot = argc > 2 ? std::atoi(argv[2]) : 1000;
+	const int changes = argc > 3 ? std::atoi(argv[3]) : 300;
+
+	auto nursery = std::make_shared<Nursery>();
+	nursery->setCustomersPerDay(0);
+	std::vector<std::shared_ptr<Group>> beds;
+	std::vector<std::shared_ptr<Plant>> plants;
+	for (int p = 0; p < plots; ++p) {
+		beds.push_back(nursery->addPlot("Bed " + std::to_string(p)));
+		for (auto& plant : nursery->stockPlants(p % 3 == 0 ? "Cactus" : "Rose", static_cast<std::size_t>(perPlot), beds.back())) {
+			plants.push_back(std::move(plant));
+		}
+	}
+	const Inventory& inventory = *nursery->getInventory();
+	// A predicate view (one plant in a thousand): re-recorded by every capture.
+	auto sample = nursery->getInventory()->createView("Sample", [](const Plant& plant) { return plant.getId() % 1000 == 0; });
+
+	SnapshotRecorder history;
+	const Capture first = capture(history, inventory);
+	const std::string firstJson = json(*first.snapshot);
+
+	// A few hundred changes spread over the nursery: waterings, plus a move every tenth change.
+	for (int i = 0; i < changes; ++i) {
+		const std::size_t index = (static_cast<std::size_t>(i) * 7919u) % plants.size();
+		if (i % 10 == 9) beds[static_cast<std::size_t>(i) % beds.size()]->add(plants[index]);
+		else plants[index]->water();
+	}
+	const Capture incremental = capture(history, inventory);
+	SnapshotRecorder fresh;
+	const Capture full = capture(fresh, inventory);
+
+	nursery->runSimulation(1);
+	const Capture afterTick = capture(history, inventory);
+	SnapshotRecorder freshAfterTick;
+	const std::string afterTickJson = json(*freshAfterTick.capture(inventory));
+
+	std::cout << "plants=" << plants.size() << " plots=" << plots << " changes=" << changes
+		<< " view members=" << sample->memberCount() << "\n";
+	report("first capture:       ", first);
+	report("after changes, full: ", full);
+	report("after changes, COW:  ", incremental);
+	report("after a day tick:    ", afterTick);
+	std::cout << "COW vs full: " << full.seconds / incremental.seconds << "x faster, "
+		<< static_cast<double>(full.bytes) / static_cast<double>(incremental.bytes) << "x less memory\n";
+
+	const bool same = json(*incremental.snapshot) == json(*full.snapshot) && json(*first.snapshot) == firstJson
+		&& json(*afterTick.snapshot) == afterTickJson;
+	if (!same || incremental.stats.recorded > full.stats.recorded / 10) {
+		std::cerr << "mismatch: incremental snapshot differs from a full one or copied too much\n";
+		return 1;
+	}
+	std::cout << "same document as a full capture, earlier snapshot untouched: yes\n";
+	return 0;
+}
@@ -0,0 +1,98 @@
+// Contention benchmark for command submission: P producer threads enqueue while
+// one consumer drains in batches, comparing the lock-free MpscRing used by
+// Nursery::addRequest() with a mutex-guarded std::queue.
+// Usage: SubmissionBench [itemsPerRun] [maxProducers]
+#include "../include/Core/MpscRing.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kBatch = 256; // items the consumer takes per drain call
+
+class MutexQueue {
+public:
+	bool tryPush(uint64_t&& value) {
+		std::lock_guard<std::mutex> lock(mutex);
+		items.push(value);
+		return true;
+	}
+
+	template <typename Fn>
+	std::size_t drain(Fn&& fn, std::size_t maxItems) {
+		std::lock_guard<std::mutex> lock(mutex);
+		std::size_t taken = 0;
+		for (; taken < maxItems && !items.empty(); ++taken) {
+			fn(std::move(items.front()));
+			items.pop();
+		}
+		return taken;
+	}
+
+private:
+	std::mutex mutex;
+	std::queue<uint64_t> items;
+};
+
+// Returns millions of items per second moved from 'producers' threads to one consumer.
+template <typename Queue>
+double run(Queue& queue, unsigned producers, uint64_t items, uint64_t& checksum) {
+	const uint64_t perProducer = items / producers;
+	std::atomic<bool> go{false};
+	std::vector<std::thread> threads;
+	for (unsigned p = 0; p < producers; ++p) {
+		threads.emplace_back([&queue, &go, p, perProducer] {
+			while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+			for (uint64_t i = 0; i < perProducer; ++i) {
+				uint64_t value = (uint64_t{p} << 40) | i;
+				while (!queue.tryPush(std::move(value))) std::this_thread::yield(); // full: back off
+			}
+		});
+	}
+
+	const uint64_t expected = perProducer * producers;
+	uint64_t received = 0;
+	uint64_t sum = 0;
+	const auto start = std::chrono::steady_clock::now();
+	go.store(true, std::memory_order_release);
+	while (received < expected) {
+		const std::size_t taken = queue.drain([&sum](uint64_t&& value) { sum += value; }, kBatch);
+		received += taken;
+		if (taken == 0) std::this_thread::yield();
+	}
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	for (auto& thread : threads) thread.join();
+	checksum = sum;
+	return static_cast<double>(expected) / seconds / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const uint64_t items = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+	const unsigned maxProducers = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 64;
+
+	std::printf("items=%llu batch=%zu hardware threads=%u\n", static_cast<unsigned long long>(items), kBatch,
+		std::thread::hardware_concurrency());
+	std::printf("%9s %16s %16s %8s\n", "producers", "ring Mitems/s", "mutex Mitems/s", "ratio");
+	for (unsigned producers = 1; producers <= maxProducers; producers *= 2) {
+		MpscRing<uint64_t> ring(4096);
+		MutexQueue locked;
+		uint64_t ringSum = 0;
+		uint64_t mutexSum = 0;
+		const double ringRate = run(ring, producers, items, ringSum);
+		const double mutexRate = run(locked, producers, items, mutexSum);
+		std::printf("%9u %16.2f %16.2f %7.2fx%s\n", producers, ringRate, mutexRate, ringRate / mutexRate,
+			ringSum == mutexSum ? "" : "  CHECKSUM MISMATCH");
+		if (ringSum != mutexSum) return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+// Reads and compares the names of many plants of a few species the old way
+// (getName()/typeName() copies and string compares) and through the interned
+// accessors (nameView()/typeNameView() and Symbol compares), and checks that
+// every plant of a species shares one name buffer.
+// Usage: SymbolBench [plants] [passes]
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Rose.h"
+#include "../include/Core/Symbol.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 5;
+
+	// Long enough species names that a copy cannot live in the small-string buffer.
+	const std::string roseName = "Rosa 'Gertrude Jekyll' (English shrub rose)";
+	const std::string cactusName = "Echinocactus grusonii (golden barrel cactus)";
+	std::vector<std::shared_ptr<Plant>> plants;
+	plants.reserve(static_cast<std::size_t>(count));
+	const std::size_t internedBefore = Symbol::internedCount();
+	for (long i = 0; i < count; ++i) {
+		if (i % 4 == 0) plants.push_back(std::make_shared<Cactus>(cactusName, 12.5));
+		else plants.push_back(std::make_shared<Rose>(roseName, 25.1));
+	}
+	const std::size_t newSymbols = Symbol::internedCount() - internedBefore;
+
+	long copiedMatches = 0;
+	long internedMatches = 0;
+	const double copySeconds = timed(passes, [&] {
+		copiedMatches = 0;
+		for (const auto& plant : plants) copiedMatches += plant->getName() == roseName;
+	});
+	const Symbol rose(roseName);
+	const double symbolSeconds = timed(passes, [&] {
+		internedMatches = 0;
+		for (const auto& plant : plants) internedMatches += plant->getNameSymbol() == rose;
+	});
+
+	std::size_t copiedChars = 0;
+	std::size_t viewedChars = 0;
+	const double typeCopySeconds = timed(passes, [&] {
+		copiedChars = 0;
+		for (const auto& plant : plants) copiedChars += plant->getName().size() + plant->typeName().size();
+	});
+	const double typeViewSeconds = timed(passes, [&] {
+		viewedChars = 0;
+		for (const auto& plant : plants) viewedChars += plant->nameView().size() + plant->typeNameView().size();
+	});
+
+	bool shared = true;
+	for (const auto& plant : plants) {
+		const auto& first = plant->typeNameView() == "Rose" ? plants[1] : plants[0];
+		shared = shared && plant->nameView().data() == first->nameView().data();
+	}
+
+	std::cout << "plants=" << count << " new symbols=" << newSymbols << "\n";
+	std::cout << "name match, getName() copy: " << copySeconds * 1e3 << " ms\n";
+	std::cout << "name match, Symbol compare: " << symbolSeconds * 1e3 << " ms (" << copySeconds / symbolSeconds << "x)\n";
+	std::cout << "name+type, copies:          " << typeCopySeconds * 1e3 << " ms\n";
+	std::cout << "name+type, views:           " << typeViewSeconds * 1e3 << " ms (" << typeCopySeconds / typeViewSeconds << "x)\n";
+
+	if (copiedMatches != internedMatches || copiedChars != viewedChars || !shared || newSymbols > 2) {
+		std::cerr << "mismatch: interned names disagree with the copies or are not shared\n";
+		return 1;
+	}
+	std::cout << "one buffer per species, same answers: yes\n";
+	return 0;
+}
@@ -0,0 +1,180 @@
+// Times the two lookups the type registry replaces: finding a species' factory
+// (a std::map keyed by name against an array indexed by type id) and resolving
+// a serialized record's type (the name against the id). Then round-trips one
+// record of every registered type through TypeRegistry::instantiate(), once as
+// written and once with the type given by name as older files do, and checks
+// that both come back as the same type and serialize to the same record, with
+// every plant field (grown, watered and aged on purpose) restored.
+// Usage: TypeRegistryBench [lookups] [passes]
+#include "../include/Components/Cactus.h"
+#include "../include/Components/Group.h"
+#include "../include/Components/Rose.h"
+#include "../include/Components/TypeRegistry.h"
+#include "../include/Core/Json.h"
+#include "../include/Patterns/Decorator/DecoratedItem.h"
+#include "../include/Patterns/Decorator/GiftWrapDecorator.h"
+#include "../include/Patterns/Decorator/PlantDecorator.h"
+#include "../include/Patterns/Decorator/PotDecorator.h"
+#include "../include/Patterns/Decorator/RibbonDecorator.h"
+#include "../include/Patterns/Factory/CactusFactory.h"
+#include "../include/Patterns/Factory/RoseFactory.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+// 'record' with every "id" value blanked, since loaded components get fresh ids.
+std::string withoutIds(const std::string& record) {
+	std::string out;
+	for (std::size_t i = 0; i < record.size(); ++i) {
+		out.push_back(record[i]);
+		if (record.compare(i, 5, "\"id\":") == 0) {
+			out.append("id\":");
+			for (i += 5; i < record.size() && record[i] >= '0' && record[i] <= '9'; ++i) {}
+			--i;
+		}
+	}
+	return out;
+}
+
+// 'record' with each numeric "type" replaced by the type's name, as records were written before ids.
+std::string withTypeNames(const std::string& record) {
+	const TypeRegistry& types = TypeRegistry::shared();
+	std::string out;
+	for (std::size_t i = 0; i < record.size();) {
+		if (record.compare(i, 7, "\"type\":") != 0) {
+			out.push_back(record[i++]);
+			continue;
+		}
+		i += 7;
+		std::size_t end = i;
+		while (end < record.size() && record[end] >= '0' && record[end] <= '9') ++end;
+		const auto id = static_cast<ComponentTypeId>(std::strtoul(record.substr(i, end - i).c_str(), nullptr, 10));
+		out += "\"type\":" + Json::quote(types.info(id).name.view());
+		i = end;
+	}
+	return out;
+}
+
+// The plant a sample holds, looking through decorators; null for groups.
+const Plant* plantIn(const InventoryComponent& component) {
+	const InventoryComponent* inner = &component;
+	while (auto decorator = dynamic_cast<const PlantDecorator*>(inner)) inner = decorator->getWrappedComponent().get();
+	return dynamic_cast<const Plant*>(inner);
+}
+
+bool samePlantFields(const InventoryComponent& a, const InventoryComponent& b) {
+	const Plant* left = plantIn(a);
+	const Plant* right = plantIn(b);
+	if (!left || !right) return left == right;
+	return left->nameView() == right->nameView() && left->getPrice() == right->getPrice()
+		&& left->getAge() == right->getAge() && left->getHealth() == right->getHealth()
+		&& left->getWaterLevel() == right->getWaterLevel() && left->getStage() == right->getStage()
+		&& left->getThirst() == right->getThirst();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long lookups = argc > 1 ? std::atol(argv[1]) : 2000000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 5;
+	const TypeRegistry& types = TypeRegistry::shared();
+
+	// Factory lookup per spawned plant.
+	std::map<std::string, std::shared_ptr<PlantFactory>> byName{
+		{"Cactus", std::make_shared<CactusFactory>()}, {"Rose", std::make_shared<RoseFactory>()}};
+	std::vector<std::shared_ptr<PlantFactory>> byId(types.size());
+	byId[types.idOf(ComponentKind::Cactus)] = byName["Cactus"];
+	byId[types.idOf(ComponentKind::Rose)] = byName["Rose"];
+	const std::string speciesNames[] = {"Rose", "Cactus"};
+	const ComponentTypeId speciesIds[] = {types.idOf(ComponentKind::Rose), types.idOf(ComponentKind::Cactus)};
+	uintptr_t nameSum = 0;
+	uintptr_t idSum = 0;
+	const double mapSeconds = timed(passes, [&] {
+		for (long i = 0; i < lookups; ++i) nameSum += reinterpret_cast<uintptr_t>(byName.find(speciesNames[i & 1])->second.get());
+	});
+	const double arraySeconds = timed(passes, [&] {
+		for (long i = 0; i < lookups; ++i) idSum += reinterpret_cast<uintptr_t>(byId[speciesIds[i & 1]].get());
+	});
+
+	// One component of every registered type; plants away from their fresh state so loading must restore it.
+	std::vector<std::shared_ptr<InventoryComponent>> samples;
+	auto rose = std::make_shared<Rose>("Rose \"Peace\"", 25.5);
+	rose->setAge(41);
+	rose->setHealth(63);
+	rose->setWaterLevel(17);
+	rose->setStage(LifecycleStage::Mature);
+	auto wrappedCactus = std::make_shared<Cactus>("Cactus", 9.0);
+	wrappedCactus->setAge(300);
+	wrappedCactus->setHealth(5);
+	wrappedCactus->setWaterLevel(0);
+	wrappedCactus->setStage(LifecycleStage::Withering);
+	samples.push_back(std::make_shared<Group>("Bed\t1", false));
+	samples.push_back(rose);
+	samples.push_back(std::make_shared<Cactus>("Cactus", 12.25));
+	samples.push_back(std::make_shared<PotDecorator>(std::make_shared<Rose>("Rose", 20.0)));
+	samples.push_back(std::make_shared<RibbonDecorator>(std::make_shared<PotDecorator>(wrappedCactus)));
+	samples.push_back(std::make_shared<GiftWrapDecorator>(std::make_shared<Rose>("Rose", 20.0)));
+	samples.push_back(std::make_shared<DecoratedItem>(rose, std::initializer_list<DecoratedItem::AddOn>{
+		DecoratedItem::AddOn::Pot, DecoratedItem::AddOn::GiftWrap}));
+
+	std::vector<std::string> records;
+	std::vector<std::string> legacyRecords;
+	for (const auto& sample : samples) {
+		records.push_back(sample->serialize());
+		legacyRecords.push_back(withTypeNames(records.back()));
+	}
+
+	// Type resolution per loaded record.
+	uint64_t resolvedById = 0;
+	uint64_t resolvedByName = 0;
+	const long resolves = lookups / static_cast<long>(records.size());
+	const double idResolveSeconds = timed(passes, [&] {
+		for (long i = 0; i < resolves; ++i) {
+			for (const auto& record : records) resolvedById += types.typeOfRecord(record);
+		}
+	});
+	const double nameResolveSeconds = timed(passes, [&] {
+		for (long i = 0; i < resolves; ++i) {
+			for (const auto& record : legacyRecords) resolvedByName += types.typeOfRecord(record);
+		}
+	});
+
+	bool roundTrips = samples.size() == types.size();
+	for (std::size_t i = 0; i < samples.size(); ++i) {
+		const auto loaded = types.instantiate(records[i]);
+		const auto legacy = types.instantiate(legacyRecords[i]);
+		roundTrips = roundTrips && loaded->typeId() == samples[i]->typeId() && legacy->typeId() == samples[i]->typeId()
+			&& withoutIds(loaded->serialize()) == withoutIds(records[i]) && withoutIds(legacy->serialize()) == withoutIds(records[i])
+			&& loaded->getPrice() == samples[i]->getPrice() && loaded->nameView() == samples[i]->nameView()
+			&& samePlantFields(*loaded, *samples[i]) && samePlantFields(*legacy, *samples[i]);
+	}
+
+	std::cout << "types=" << types.size() << " lookups=" << lookups << "\n";
+	std::cout << "factory, map by name:  " << mapSeconds * 1e3 << " ms\n";
+	std::cout << "factory, array by id:  " << arraySeconds * 1e3 << " ms (" << mapSeconds / arraySeconds << "x)\n";
+	std::cout << "record type, by name:  " << nameResolveSeconds * 1e3 << " ms\n";
+	std::cout << "record type, by id:    " << idResolveSeconds * 1e3 << " ms (" << nameResolveSeconds / idResolveSeconds << "x)\n";
+	std::cout << "sample record: " << records.back() << "\n";
+
+	if (nameSum != idSum || resolvedById != resolvedByName || !roundTrips) {
+		std::cerr << "mismatch: id dispatch disagrees with name dispatch or a record did not round-trip\n";
+		return 1;
+	}
+	std::cout << "every type round-trips, by id and by name: yes\n";
+	return 0;
+}
@@ -0,0 +1,135 @@
+// Tallies a generated inventory (plain and decorated roses and cacti in plots)
+// three ways: the virtual path (Iterator next()/hasNext(), dynamic_cast to skip
+// groups, virtual getPrice()/typeName() per element), the same virtual calls
+// over a ComponentTree walk (no iterator, still a vtable hop per element), and
+// visitPreOrder() with a visitor dispatched on ComponentKind. Checks all three
+// agree to the bit.
+// Usage: VisitorBench [plants] [plots] [passes]
+#include "../include/Core/Inventory.h"
+#include "../include/Patterns/Iterator/Iterator.h"
+#include "../include/Patterns/Visitor/ComponentVisitor.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Tally {
+	double price{0.0};
+	long roses{0};
+	long decorated{0};
+};
+
+bool operator==(const Tally& a, const Tally& b) {
+	return std::memcmp(&a.price, &b.price, sizeof a.price) == 0 && a.roses == b.roses && a.decorated == b.decorated;
+}
+
+// The same question asked through virtual calls, as callers did before ComponentKind.
+void countVirtual(const InventoryComponent& component, Tally& tally) {
+	if (dynamic_cast<const Group*>(&component)) return;
+	tally.price += component.getPrice();
+	const std::string type = component.typeName();
+	if (type == "Rose") ++tally.roses;
+	else if (type != "Cactus") ++tally.decorated;
+}
+
+// Price of a (possibly decorated) item with every step dispatched statically.
+double priceOf(const InventoryComponent& component) {
+	return visitComponent(component, Overloaded{
+		[](const Group&) { return 0.0; },
+		[](const Rose& rose) { return rose.getPrice(); },
+		[](const Cactus& cactus) { return cactus.getPrice(); },
+		[](const PlantDecorator& decorator) { return decorator.getPrice(); },
+		[](const DecoratedItem& item) { return item.getPrice(); },
+		[](const auto& decorator) -> double {
+			return priceOf(*decorator.getWrappedComponent()) + std::decay_t<decltype(decorator)>::kSurcharge;
+		},
+		[](const InventoryComponent& other) { return other.getPrice(); }});
+}
+
+template <typename Fn>
+double timed(int passes, Fn&& fn) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const long plants = argc > 1 ? std::atol(argv[1]) : 1000000;
+	const long plots = argc > 2 ? std::atol(argv[2]) : 1024;
+	const int passes = argc > 3 ? std::atoi(argv[3]) : 5;
+
+	// One item in eight is decorated: potted, with a ribbon, or potted and gift wrapped.
+	auto inventory = std::make_shared<Inventory>();
+	std::vector<std::shared_ptr<Group>> groups;
+	for (long p = 0; p < plots; ++p) {
+		groups.push_back(std::make_shared<Group>("Plot " + std::to_string(p)));
+		inventory->add(groups.back());
+	}
+	for (long i = 0; i < plants; ++i) {
+		std::shared_ptr<InventoryComponent> item;
+		if (i % 3 == 0) item = std::make_shared<Cactus>("Cactus", 12.5);
+		else item = std::make_shared<Rose>("Rose", 25.1);
+		switch (i % 24) {
+		case 7: item = std::make_shared<PotDecorator>(item); break;
+		case 15: item = std::make_shared<RibbonDecorator>(item); break;
+		case 23: item = std::make_shared<GiftWrapDecorator>(std::make_shared<PotDecorator>(item)); break;
+		default: break;
+		}
+		groups[static_cast<std::size_t>(i % plots)]->add(item);
+	}
+
+	Tally iterated;
+	const double iteratorSeconds = timed(passes, [&] {
+		iterated = Tally{};
+		auto iterator = inventory->createIterator();
+		while (iterator->hasNext()) countVirtual(*iterator->next(), iterated);
+	});
+
+	const ComponentTree& tree = ComponentTree::shared();
+	Tally walked;
+	const double walkSeconds = timed(passes, [&] {
+		walked = Tally{};
+		for (const auto& root : inventory->getComponents()) {
+			tree.forEachPreOrder(root->treeNode(), [&](ComponentTree::Handle node) { countVirtual(*tree.component(node), walked); });
+		}
+	});
+
+	Tally visited;
+	const double visitorSeconds = timed(passes, [&] {
+		visited = Tally{};
+		for (const auto& root : inventory->getComponents()) {
+			visitPreOrder(static_cast<const InventoryComponent&>(*root), Overloaded{
+				[](const Group&) {},
+				[&](const Rose& rose) {
+					visited.price += rose.getPrice();
+					++visited.roses;
+				},
+				[&](const Cactus& cactus) { visited.price += cactus.getPrice(); },
+				[&](const auto& item) {
+					visited.price += priceOf(item);
+					++visited.decorated;
+				}});
+		}
+	});
+
+	std::cout << "plants=" << plants << " plots=" << plots << " roses=" << visited.roses
+		<< " decorated=" << visited.decorated << "\n";
+	std::cout << "Iterator + virtual calls:   " << iteratorSeconds * 1e3 << " ms/pass\n";
+	std::cout << "tree walk + virtual calls:  " << walkSeconds * 1e3 << " ms/pass\n";
+	std::cout << "visitPreOrder (ComponentKind): " << visitorSeconds * 1e3 << " ms/pass ("
+		<< iteratorSeconds / visitorSeconds << "x vs Iterator, " << walkSeconds / visitorSeconds << "x vs tree walk)\n";
+
+	if (!(iterated == walked) || !(walked == visited)) {
+		std::cerr << "mismatch: the visitor disagrees with the virtual path\n";
+		return 1;
+	}
+	std::cout << "same tally: yes\n";
+	return 0;
+}
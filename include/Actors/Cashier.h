@@ -12,6 +12,8 @@ public:
     Cashier();
     ~Cashier() override = default;
 
+    const char* roleName() const noexcept override;
+    bool canHandle(Command::Kind kind) const noexcept override;
     void handleRequest(std::unique_ptr<Command> cmd) override;
 };
 
@@ -1,6 +1,9 @@
-
 #pragma once
 #include <memory>
+#include <vector>
+
+// Forward declaration
+class InventoryComponent;
 
 /**
  * @class Customer
@@ -12,9 +15,17 @@
  * The Customer object itself is mainly used to link a request to a specific entity.
  */
 class Customer : public std::enable_shared_from_this<Customer> {
+private:
+    // Items handed over by the Cashier; the customer owns them once sold.
+    std::vector<std::shared_ptr<InventoryComponent>> purchases;
+
 public:
     Customer();
     ~Customer() = default;
+
+    // Takes ownership of a sold (possibly decorated) item.
+    void receive(const std::shared_ptr<InventoryComponent>& item);
+    const std::vector<std::shared_ptr<InventoryComponent>>& getPurchases() const noexcept { return purchases; }
     
     // Customers might have properties like a name or a budget in a more complex simulation.
 };
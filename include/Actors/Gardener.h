@@ -8,13 +8,15 @@
  * @brief A concrete handler in the Chain of Responsibility.
  * 
  * This staff member is responsible for handling plant-care related commands
- * like WaterPlantCommand.
+ * like WaterPlantCommand and BatchWaterCommand.
  */
 class Gardener : public Staff {
 public:
     Gardener();
     ~Gardener() override = default;
 
+    const char* roleName() const noexcept override;
+    bool canHandle(Command::Kind kind) const noexcept override;
     void handleRequest(std::unique_ptr<Command> cmd) override;
 };
 
@@ -1,9 +1,9 @@
 
 #pragma once
 #include <memory>
-
-// Forward declaration
-class Command;
+#include <cstddef>
+#include <limits>
+#include "../Patterns/Command/Command.h"
 
 /**
  * @class Staff
@@ -13,15 +13,39 @@ class Command;
  * handleRequest method and holds a shared_ptr to the next staff member
  * in the chain (the 'successor'). This allows a request to be passed along
  * until a staff member claims and handles it.
+ *
+ * The Nursery itself does not walk the chain: its CommandRouter looks up the
+ * pool of staff whose canHandle() accepts a command's Kind and calls perform()
+ * on the least-loaded one, within each member's daily capacity.
  */
 class Staff : public std::enable_shared_from_this<Staff> {
 protected:
     std::shared_ptr<Staff> successor;
+    std::size_t dailyCapacity;
 
 public:
+    // Capacity of a staff member with no daily limit.
+    static constexpr std::size_t kUnlimited = std::numeric_limits<std::size_t>::max();
+
     Staff();
     virtual ~Staff() = default;
 
+    // Role shown in reports, e.g. "Gardener".
+    virtual const char* roleName() const noexcept = 0;
+
+    // Whether this staff member performs commands of 'kind' (used by the chain and the router).
+    virtual bool canHandle(Command::Kind kind) const noexcept = 0;
+
+    /**
+     * @brief Executes a command that was routed directly to this staff member.
+     * @param cmd A command of a kind accepted by canHandle() (ownership transferred).
+     */
+    virtual void perform(std::unique_ptr<Command> cmd);
+
+    // Work units (Command::workUnits()) this member can take on per day; kUnlimited by default.
+    std::size_t getDailyCapacity() const noexcept { return dailyCapacity; }
+    void setDailyCapacity(std::size_t units) noexcept { dailyCapacity = units; }
+
     /**
      * @brief Sets the next handler in the chain.
      * @param next The next Staff member in the chain.
@@ -36,5 +60,13 @@ public:
      * @param cmd The Command object to be processed (ownership transferred).
      */
     virtual void handleRequest(std::unique_ptr<Command> cmd) = 0;
+
+protected:
+    /**
+     * @brief Forwards a command this handler does not accept to the successor.
+     *
+     * At the end of the chain the command is marked Failed and dropped.
+     */
+    void passToSuccessor(std::unique_ptr<Command> cmd);
 };
 
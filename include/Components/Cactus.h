@@ -2,15 +2,19 @@
 #include "Plant.h"
 #include <memory>
 
-class Cactus : public Plant {
+class Cactus final : public Plant {
 public:
-    Cactus(const std::string& name, double price);
+    Cactus(Symbol name, double price, std::shared_ptr<PlantStore> store = nullptr);
     ~Cactus() override = default;
 
     void water() override;
+    // Waters 'count' plants with one non-virtual loop (used by BatchWaterCommand).
+    static void waterAll(Cactus* const* cacti, std::size_t count);
+    WaterLevel getWaterRequirement() const override;
+    SunLevel getSunRequirement() const override;
     std::shared_ptr<InventoryComponent> clone() const override;
     std::shared_ptr<InventoryComponent> blueprintClone() const override;
     std::string serialize() const override;
     void deserialize(const std::string& data) override;
-    std::string typeName() const override;
+    std::string_view typeNameView() const override;
 };
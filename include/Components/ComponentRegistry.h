@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Forward declaration: the registry only stores pointers to live components.
+class InventoryComponent;
+
+/**
+ * @class ComponentRegistry
+ * @brief Index from InventoryComponent::getId() to the live component carrying that id.
+ *
+ * Every InventoryComponent registers itself on construction, moves its entry on
+ * setId() and drops it on destruction, so resolving a serialized targetId or a
+ * Memento reference is one hash probe instead of a walk over the inventory.
+ * Ownership moves need no update: the owner is read from the ComponentTree.
+ *
+ * Ids are unique among freshly created components, but snapshot clones keep the
+ * id of their original. The first live holder of an id keeps the entry, so
+ * find() keeps returning the live component rather than a copy taken from it;
+ * later holders wait in line, and when the entry's holder is erased the oldest
+ * one still alive takes it over. setId() refuses an id held by another
+ * component, so only clones ever share one.
+ *
+ * The table is split into shards, each an open-addressing (linear probing) hash.
+ * Ids are handed out in per-thread blocks and a whole block maps to one shard,
+ * so threads creating components in bulk rarely share a writer lock. find()
+ * takes no lock: each shard is a seqlock, and a lookup that overlaps a write
+ * retries. Tables outgrown by a shard are kept until the registry is destroyed,
+ * since a lookup may still be probing one; sizes double, so a shard's retired
+ * tables together take less memory than its current one.
+ */
+class ComponentRegistry {
+public:
+	// Ids per block a thread claims from the global counter (see InventoryComponent).
+	static constexpr uint64_t kIdBlock = 1024;
+
+	ComponentRegistry() = default;
+	ComponentRegistry(const ComponentRegistry&) = delete;
+	ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+
+	// Process-wide registry every InventoryComponent registers with. Never destroyed,
+	// so components owned by other statics can still unregister at exit.
+	static ComponentRegistry& shared();
+
+	// Maps 'id' to 'component' unless another component already holds it. Id 0 is never indexed.
+	// Returns whether 'component' now holds the entry.
+	bool insert(uint64_t id, InventoryComponent* component);
+	// Drops 'component' as a holder of 'id'. If it held the entry, the next holder in line takes it over.
+	void erase(uint64_t id, const InventoryComponent* component);
+
+	// The live component registered under 'id', or nullptr. Lock-free; safe against concurrent writers.
+	InventoryComponent* find(uint64_t id) const;
+
+	// Number of indexed components.
+	std::size_t size() const;
+
+private:
+	struct Slot {
+		std::atomic<uint64_t> id{0}; // 0 marks an empty slot
+		std::atomic<InventoryComponent*> component{nullptr};
+	};
+
+	struct Table {
+		explicit Table(std::size_t size) : mask(size - 1), slots(new Slot[size]) {}
+		std::size_t mask; // size - 1; the size is a power of two
+		std::unique_ptr<Slot[]> slots;
+	};
+
+	struct Shard {
+		std::atomic<Table*> table{nullptr}; // at most half full
+		std::atomic<uint64_t> sequence{0};  // odd while a writer is changing 'table'
+		std::size_t count{0};
+		std::vector<std::unique_ptr<Table>> tables; // the current one last; older ones retired
+		// Holders of an id other than the one indexed, oldest first (snapshot clones; usually empty).
+		std::unordered_map<uint64_t, std::vector<InventoryComponent*>> waiting;
+		mutable std::mutex mutex; // serializes writers
+	};
+
+	static constexpr std::size_t kShards = 16;
+
+	static std::size_t shardIndex(uint64_t id) noexcept { return (id / kIdBlock) % kShards; }
+	static std::size_t home(const Table& table, uint64_t id) noexcept;
+	static void grow(Shard& shard);
+	// Bracket a change readers must not observe half-done; call with the shard's mutex held.
+	static void beginWrite(Shard& shard) noexcept;
+	static void endWrite(Shard& shard) noexcept;
+
+	std::array<Shard, kShards> shards;
+};
@@ -0,0 +1,160 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Forward declaration: each live node remembers the component it stands for.
+class InventoryComponent;
+
+/**
+ * @class ComponentTree
+ * @brief Arena holding the ownership tree of the inventory composite as index-linked nodes.
+ *
+ * Every InventoryComponent owns one node here, addressed by a 32-bit Handle. A
+ * node records its component plus the handles of its parent, first and last
+ * child and previous and next sibling, so walking the tree reads contiguous
+ * 32-byte nodes instead of chasing shared_ptrs through their control blocks,
+ * and finding a component's owner needs no weak_ptr. Owning Groups link their
+ * children here (see InventoryComponent::setOwner()); view Groups and the
+ * Inventory's top level add no edges, so top-level and unplaced components are
+ * roots.
+ *
+ * Churn scatters related nodes over the arena and leaves holes behind.
+ * defragment() relays every live node out in depth-first order (roots in handle
+ * order) and drops the holes. It renumbers handles: components are updated, but
+ * any handle kept elsewhere is only valid until the next defragment(). It
+ * never runs implicitly; layoutGeneration() tells holders of handles whether
+ * it ran since they took theirs.
+ *
+ * Nodes also carry change stamps for incremental snapshots (see
+ * SnapshotRecorder): a change is stamped with the current change epoch on the
+ * node and every ancestor, so a subtree whose root carries an older stamp than
+ * a snapshot has not changed since that snapshot was taken.
+ *
+ * Allocation, release and defragmentation are serialized internally; linking,
+ * marking and walking are not, matching the rules for mutating Groups. Nodes
+ * live in fixed-size chunks that are never moved or freed before the tree is,
+ * so allocating on one thread (components created off the simulation thread)
+ * never invalidates another thread's walk or relink of other nodes.
+ */
+class ComponentTree {
+public:
+	using Handle = uint32_t;
+
+	// Handle of no node: the parent of a root, the sibling after the last child, ...
+	static constexpr Handle kNull = 0xFFFFFFFFu;
+
+	struct Node {
+		InventoryComponent* component{nullptr}; // null while the node is free
+		Handle parent{kNull};
+		Handle firstChild{kNull};
+		Handle lastChild{kNull};
+		Handle prevSibling{kNull};
+		Handle nextSibling{kNull};
+		uint32_t changeStamp{0}; // epoch of the latest change in this subtree (fills the padding)
+	};
+
+	ComponentTree();
+	~ComponentTree();
+	ComponentTree(const ComponentTree&) = delete;
+	ComponentTree& operator=(const ComponentTree&) = delete;
+
+	// Process-wide tree every InventoryComponent registers with. Never destroyed,
+	// so components owned by other statics can still release their nodes at exit.
+	static ComponentTree& shared();
+
+	// Claims a root node standing for 'component'.
+	// @throws std::length_error past kMaxNodes live and free nodes.
+	Handle allocate(InventoryComponent* component);
+	// Unlinks the node (its children become roots) and returns it to the free list.
+	void release(Handle node);
+
+	// Moves 'child' and its subtree to the end of 'parent's children.
+	void appendChild(Handle parent, Handle child);
+	// Unlinks 'node' from its parent, making it a root; its subtree moves with it.
+	void detach(Handle node);
+
+	// --- Node access (no bounds checks; handles must be live) ---
+	InventoryComponent* component(Handle node) const noexcept { return at(node).component; }
+	Handle parent(Handle node) const noexcept { return at(node).parent; }
+	Handle firstChild(Handle node) const noexcept { return at(node).firstChild; }
+	Handle nextSibling(Handle node) const noexcept { return at(node).nextSibling; }
+
+	// Number of live nodes / number of nodes including free ones.
+	std::size_t size() const;
+	std::size_t capacity() const noexcept { return nodeCount.load(std::memory_order_acquire); }
+
+	// Calls fn(Handle) for each child of 'node' in order. fn must not relink the tree.
+	template <typename Fn>
+	void forEachChild(Handle node, Fn&& fn) const {
+		for (Handle child = at(node).firstChild; child != kNull; child = at(child).nextSibling) fn(child);
+	}
+
+	// Calls fn(Handle) for 'root' and then its subtree in pre-order, without a stack. fn must not relink the tree.
+	template <typename Fn>
+	void forEachPreOrder(Handle root, Fn&& fn) const {
+		if (root == kNull) return;
+		Handle node = root;
+		for (;;) {
+			fn(node);
+			if (at(node).firstChild != kNull) {
+				node = at(node).firstChild;
+				continue;
+			}
+			while (node != root && at(node).nextSibling == kNull) node = at(node).parent;
+			if (node == root) return;
+			node = at(node).nextSibling;
+		}
+	}
+
+	// --- Change marks (incremental snapshots) ---
+	// Linking, unlinking and allocating mark the nodes involved; components mark themselves
+	// when their serialized fields change (InventoryComponent::markChanged()).
+
+	uint32_t changeEpoch() const noexcept { return epoch.load(std::memory_order_relaxed); }
+	// Ends the current epoch and returns it: changes made afterwards carry a higher stamp.
+	uint32_t closeChangeEpoch() noexcept { return epoch.fetch_add(1, std::memory_order_relaxed); }
+	// Stamps 'node' and its ancestors with the current epoch, stopping at the first one already stamped.
+	void markChanged(Handle node) noexcept;
+	// Counts every node as changed in the current epoch. For bulk plant-state updates
+	// (PlantStore::tick()) that bypass the components; safe to call from parallel tick units.
+	void markAllChanged() noexcept { allChangedStamp.store(changeEpoch(), std::memory_order_relaxed); }
+	// Epoch of the latest change to 'node' or anything in its subtree.
+	uint32_t changedAt(Handle node) const noexcept {
+		const uint32_t all = allChangedStamp.load(std::memory_order_relaxed);
+		return at(node).changeStamp > all ? at(node).changeStamp : all;
+	}
+
+	// Whether holes and relinks since the last defragment() have piled up enough to make one worthwhile.
+	bool fragmented() const;
+
+	// Relays the live nodes out in depth-first order and drops the free ones.
+	void defragment();
+	// Number of defragment() calls so far: handles taken under another generation are stale.
+	uint64_t layoutGeneration() const noexcept { return generation.load(std::memory_order_acquire); }
+
+	// Nodes per chunk, and the most nodes (live and free) the tree holds.
+	static constexpr unsigned kChunkBits = 12;
+	static constexpr std::size_t kChunkNodes = std::size_t{1} << kChunkBits;
+	static constexpr std::size_t kMaxChunks = std::size_t{1} << 16;
+	static constexpr std::size_t kMaxNodes = kChunkNodes * kMaxChunks;
+
+private:
+	Node& at(Handle node) noexcept { return chunks[node >> kChunkBits][node & (kChunkNodes - 1)]; }
+	const Node& at(Handle node) const noexcept { return chunks[node >> kChunkBits][node & (kChunkNodes - 1)]; }
+	void unlink(Handle node) noexcept;
+
+	// Chunk directory of kMaxChunks entries. An entry is set (under allocationMutex) before
+	// any handle in its chunk exists, and never changes after, so readers need no lock.
+	std::unique_ptr<Node*[]> chunks;
+	std::atomic<std::size_t> nodeCount{0}; // handles below this have a node
+	std::vector<Handle> freeNodes;
+	std::atomic<std::size_t> relinks{0}; // appendChild()/detach() calls since the last defragment()
+	std::atomic<uint32_t> epoch{1};
+	std::atomic<uint32_t> allChangedStamp{0};
+	std::atomic<uint64_t> generation{0};
+	mutable std::mutex allocationMutex;
+};
@@ -1,8 +1,17 @@
 
 #pragma once
 #include "InventoryComponent.h"
+#include "PlantStore.h"
+#include "../Patterns/State/LifecycleRules.h"
+#include <array>
+#include <atomic>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <cstdint>
+
+class Plant;
+class Inventory;
 
 /**
  * @class Group
@@ -12,10 +21,40 @@
  * a tree structure. Groups may either own their children (owning collection)
  * or hold non-owning references to components that are owned elsewhere (reference collection).
  * This supports "view" groups like 'complete inventory' that must not take ownership.
+ *
+ * A predicate view (see Inventory::createView()) is a reference group whose
+ * members are not added by hand: it holds exactly the plants of one Inventory
+ * that satisfy its predicate. The Inventory re-evaluates a plant when it is
+ * placed, when it leaves and when it reports a thirst or stage event through
+ * Plant::notify(); predicates over other plant state need refreshView() after
+ * such changes. Membership tests are O(1) and members are iterated in place.
  */
 
-class Group : public InventoryComponent, public std::enable_shared_from_this<Group> {
+class Group final : public InventoryComponent, public std::enable_shared_from_this<Group> {
+public:
+	/**
+	 * @struct Aggregates
+	 * @brief Totals over every plant in a group's owned subtree.
+	 *
+	 * Decorated plants count as plants (the price includes the decorations).
+	 * minHealth and minWaterLevel are INT32_MAX when the subtree holds no plant.
+	 */
+	struct Aggregates {
+		int64_t priceCents{0};
+		uint64_t plantCount{0};
+		std::array<uint64_t, kLifecycleStageCount> stageCounts{};
+		int32_t minHealth{INT32_MAX};
+		int32_t minWaterLevel{INT32_MAX};
+	};
+
+	// Membership rule of a predicate view.
+	using Predicate = std::function<bool(const Plant&)>;
+
 private:
+	// Predicate view state, defined in Group.cpp; null for other groups.
+	struct Selection;
+	friend class Inventory; // keeps the selections of its views current
+
 	std::string name;
 	// Flag: when true the group owns added children (add() will store shared_ptrs).
 	// When false the group will treat add() as a non-owning reference (stores weak_ptrs).
@@ -27,23 +66,67 @@ private:
 	// Non-owning references to components (weak_ptr to avoid dangling owning cycles).
 	std::vector<std::weak_ptr<InventoryComponent>> referencedComponents;
 
+	std::unique_ptr<Selection> selection;
+
+	// Owning groups only. Price and plant count are kept exact by deltas pushed up the
+	// owner chain on every add/remove. The plant-state fields are rebuilt lazily, bottom-up,
+	// for the groups marked stale since the last query (see plantStateChanged()), or for
+	// every group once PlantStore::stateVersion() has moved on.
+	mutable Aggregates totals;
+	// Plant-state fields over the direct plant children alone.
+	mutable PlantStore::RangeState plantState;
+	// Owned subgroups, so combining their totals does not walk the plants.
+	std::vector<const Group*> ownedGroups;
+	// Set when a direct plant child changed; implies totalsStale.
+	mutable std::atomic<bool> plantStateStale{true};
+	// Set when anything in the owned subtree changed; every owning ancestor is then set too.
+	mutable std::atomic<bool> totalsStale{true};
+	mutable uint64_t totalsStateVersion{UINT64_MAX};
+
+	// Adds the deltas to this group and every owning ancestor, marking their state stale.
+	void propagate(int64_t priceCents, int64_t plantCount);
+	// Marks the totals of this group and its owning ancestors stale, stopping at one already marked.
+	void markTotalsStale() const noexcept;
+	// Brings the plant-state fields of this group and its stale owned subgroups up to date.
+	void refreshStateTotals() const;
+	// Re-reads plantState from the direct plant children.
+	void recomputePlantState() const;
+	// Sets the plant-state fields of totals from plantState and the owned subgroups' totals.
+	void combineStateTotals() const;
+
+	// --- Predicate view upkeep (called by the scope Inventory) ---
+	// Adds or drops 'plant' according to the predicate.
+	void select(InventoryComponent& plant);
+	// Drops 'plant' if it is a member.
+	void deselect(const InventoryComponent& plant);
+	// Queues 'plant' for re-evaluation; safe to call from parallel tick units.
+	void noteChanged(InventoryComponent& plant);
+	// Applies the queued re-evaluations in id order, so membership order stays deterministic.
+	void applyNotedChanges() const;
+	// Makes 'scope' (or nothing, emptying the view) the inventory the view selects from.
+	void bind(Inventory* scope);
+
 public:
 	// ownsChildren indicates whether this group takes ownership of added components
 	Group(const std::string& name, bool ownsChildren = true);
-	~Group() override = default;
+	// Predicate view; create through Inventory::createView(), which fills and maintains it.
+	Group(const std::string& name, Predicate predicate);
+	~Group() override;
 
 	// --- Overrides from InventoryComponent (Composite & Prototype) ---
-	std::string getName() const override;
-	double getPrice() const override; // Will sum the prices of its children.
+	std::string_view nameView() const override { return name; }
+	// Owning groups answer from their cached totals in O(1); views sum their live members.
+	double getPrice() const override;
 	std::unique_ptr<Iterator> createIterator() override; // Will create a CompositeIterator.
 	std::shared_ptr<InventoryComponent> clone() const override; // Will perform a deep copy of owned children.
 	std::shared_ptr<InventoryComponent> blueprintClone() const override;
 	std::string serialize() const override;
 	void deserialize(const std::string& data) override;
-	std::string typeName() const override;
+	std::string_view typeNameView() const override;
 
 	// --- Composite-specific methods ---
-	// Adds a component. Behavior depends on the group's 'ownsChildren' flag:
+	// Adds a component. Behavior depends on the group's 'ownsChildren' flag
+	// (predicate views ignore add() and remove(): their predicate decides):
 	// - if ownsChildren == true, the component will be stored as a shared_ptr and owned by this group.
 	// - if ownsChildren == false, the component will be referenced weakly and not owned.
 	//   * IMPORTANT: If the component already has an owner (component->getOwner() != nullptr),
@@ -59,9 +142,30 @@ public:
 	// Remove component from either owned or referenced lists
 	void remove(const std::shared_ptr<InventoryComponent>& component) override;
 
+	// Selects the children moveAll() moves.
+	using Filter = std::function<bool(const InventoryComponent&)>;
+
+	/**
+	 * @brief Moves every owned child (or those 'filter' accepts) to 'destination' in one pass.
+	 *
+	 * Equivalent to destination->add(child) for each child in order, but linear:
+	 * this group's children are partitioned once instead of being erased one by
+	 * one, aggregates are adjusted once per side and the topology version is
+	 * bumped once. A move between inventories updates their PlantIndexes and
+	 * predicate views in one pass over the moved set. Children whose subtree holds 'destination' stay (they would
+	 * close a cycle). Both groups must own their children.
+	 * @return The number of children moved.
+	 */
+	std::size_t moveAll(const std::shared_ptr<Group>& destination, const Filter& filter = nullptr);
+
 	// Returns whether this Group owns children added to it.
 	// noexcept: trivial check of an internal flag.
 	bool owns() const noexcept { return ownsChildren; }
+	// Whether this is a predicate view.
+	bool isPredicateView() const noexcept { return selection != nullptr; }
+
+	// Owned children in insertion order (empty for reference groups). No copies are made.
+	const std::vector<std::shared_ptr<InventoryComponent>>& ownedChildren() const noexcept { return ownedComponents; }
 
 	// Returns a snapshot list of current members (locks weak_ptrs and excludes expired entries).
 	// Note: This returns a fresh vector of shared_ptrs and does not mutate this Group.
@@ -69,5 +173,59 @@ public:
 
 	// Prune expired weak references from referencedComponents.
 	void pruneExpiredReferences();
+
+	// Members of a predicate view, in no particular order. No copies are made; the
+	// reference is valid until the inventory next changes.
+	const std::vector<InventoryComponent*>& selectedPlants() const;
+
+	// Calls fn(InventoryComponent&) for each live member without building a vector.
+	template <typename Fn>
+	void forEachMember(Fn&& fn) const {
+		if (ownsChildren) {
+			for (const auto& component : ownedComponents) fn(*component);
+		} else if (selection) {
+			for (InventoryComponent* component : selectedPlants()) fn(*component);
+		} else {
+			for (const auto& entry : referencedComponents) {
+				if (auto component = entry.lock()) fn(*component);
+			}
+		}
+	}
+
+	// Indexed member access for walks that copy nothing (see LazyPreOrderIterator):
+	// slots follow member order and memberSlot() is null for an expired reference.
+	std::size_t memberSlots() const;
+	InventoryComponent* memberSlot(std::size_t index) const;
+
+	// Whether 'component' is a member. O(1) for predicate views, linear otherwise.
+	bool hasMember(const InventoryComponent& component) const;
+	// Number of live members.
+	std::size_t memberCount() const;
+
+	// Re-evaluates the predicate of a predicate view over its whole inventory.
+	void refreshView();
+
+	// --- Subtree aggregates ---
+	// Owning groups cover their owned subtree; a view owns nothing and walks its live members
+	// instead (members that are owning groups answer in O(1)). Views nested inside an owned
+	// subtree reference plants owned elsewhere and are not counted twice.
+
+	// Total price in cents. O(1) for owning groups.
+	int64_t getPriceCents() const;
+	// Number of (possibly decorated) plants. O(1) for owning groups.
+	uint64_t getPlantCount() const;
+	// Every aggregate, including per-stage counts and minimum health/water. O(1) for an
+	// owning group unless plant state or the tree changed since the last call.
+	Aggregates getAggregates() const;
+
+	// Marks the aggregates of the Group owning 'plant' stale; Plant's setters call it. A plant
+	// no Group owns (top-level, or wrapped by a decorator) advances PlantStore::stateVersion().
+	static void plantStateChanged(const InventoryComponent& plant) noexcept;
+	// Hands the group the state of its direct plant children, as summed over their slots by
+	// PlantStore::tickRange()/fastForward(); the Nursery's tick units call it once per plot.
+	void assignPlantState(const PlantStore::RangeState& state);
+	uint64_t getStageCount(LifecycleStage stage) const { return getAggregates().stageCounts[static_cast<std::size_t>(stage)]; }
+	int32_t getMinHealth() const { return getAggregates().minHealth; }
+	int32_t getMinWaterLevel() const { return getAggregates().minWaterLevel; }
 };
 
@@ -1,13 +1,18 @@
 
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include "ComponentTree.h"
+#include "ComponentRegistry.h"
 
 // Forward declaration to break circular dependency with Iterator.
 class Iterator;
+class Inventory;
 
 /**
  * @class InventoryComponent
@@ -24,20 +29,43 @@ class Iterator;
 // Forward declare Group to allow owner tracking.
 class Group;
 
+// Concrete type of a component, for static dispatch (see Patterns/Visitor/ComponentVisitor.h).
+// Other covers types outside this closed set; visitors see them as plain InventoryComponents.
+enum class ComponentKind : uint8_t { Other, Group, Rose, Cactus, PlantDecorator, PotDecorator, RibbonDecorator, GiftWrapDecorator, DecoratedItem };
+constexpr std::size_t kComponentKindCount = static_cast<std::size_t>(ComponentKind::DecoratedItem) + 1;
+
+// Compact id of a registered component type (see TypeRegistry); serialized records carry it as their "type".
+using ComponentTypeId = uint16_t;
+
 class InventoryComponent {
 public:
 	InventoryComponent();
+	// Copies keep the id but get a node of their own (unowned).
+	InventoryComponent(const InventoryComponent& other);
+	InventoryComponent& operator=(const InventoryComponent& other);
 	virtual ~InventoryComponent();
 
 	// Unique identifier used for serialization and reference resolution.
 	uint64_t getId() const noexcept { return id_; }
-	void setId(uint64_t id) noexcept { id_ = id; }
+	// Re-keys this component in ComponentRegistry::shared(). Throws std::invalid_argument
+	// if another live component holds 'id'; pin ids from reserveIds() to stay clear of fresh ones.
+	void setId(uint64_t id);
+	// Claims 'count' consecutive ids that are never given to a new component; returns the first.
+	static uint64_t reserveIds(uint64_t count);
+
+	// The live component with this id (see ComponentRegistry), or nullptr.
+	static InventoryComponent* findById(uint64_t id) { return ComponentRegistry::shared().find(id); }
 
 	/**
 	 * @brief Gets the name of the inventory component.
-	 * @return A string representing the component's name.
+	 *
+	 * Plants return an interned Symbol's text, valid for the life of the process;
+	 * other components' names (decorators included) are valid while the component lives.
+	 * @return A view of the component's name; no allocation is made.
 	 */
-	virtual std::string getName() const = 0;
+	virtual std::string_view nameView() const = 0;
+	// Copy of nameView().
+	std::string getName() const { return std::string(nameView()); }
 
 	/**
 	 * @brief Gets the price of the inventory component.
@@ -106,18 +134,51 @@ public:
 	virtual void remove(const std::shared_ptr<InventoryComponent>& component);
     
 	// Returns the human-readable type name, used during serialization/deserialization
-	virtual std::string typeName() const = 0;
+	// (a string literal, so the view never dangles).
+	virtual std::string_view typeNameView() const = 0;
+	// Copy of typeNameView().
+	std::string typeName() const { return std::string(typeNameView()); }
+	// This component's type id in TypeRegistry::shared(): an array lookup by kind, or a name
+	// lookup for kind Other. TypeRegistry::kUnregistered if the type was never registered.
+	ComponentTypeId typeId() const;
 
 	// Owner tracking (single-owner invariant): returns the owning Group if any.
 	std::shared_ptr<Group> getOwner() const;
+	// Links this component under 'owner' in the ComponentTree (or makes it a root when null).
 	void setOwner(const std::shared_ptr<Group>& owner);
+
+	// Concrete type tag, set by each concrete constructor; one byte, no vtable hop.
+	ComponentKind kind() const noexcept { return kind_; }
+
+	// This component's node in ComponentTree::shared(); renumbered by ComponentTree::defragment().
+	ComponentTree::Handle treeNode() const noexcept { return node_; }
+
+	// Topology version: bumped whenever a Group or the Inventory gains or loses a member,
+	// so callers can cache data derived from the tree shape and detect when it goes stale.
+	static uint64_t topologyVersion() noexcept { return topologyEpoch.load(std::memory_order_relaxed); }
+	static void touchTopology() noexcept { topologyEpoch.fetch_add(1, std::memory_order_relaxed); }
 protected:
+	// Takes 'id' the way a copy does: allowed while the original holds it, which keeps
+	// the registry entry (see ComponentRegistry). For clone() implementations.
+	void shareId(uint64_t id);
+
+	// Records a change to this component's serialized fields for incremental snapshots
+	// (ComponentTree::markChanged()). Membership changes are recorded by the tree itself.
+	void markChanged() noexcept;
+
 	uint64_t id_{0};
-	// next id generator. Definition of nextId must be provided in a .cpp file.
+	ComponentKind kind_{ComponentKind::Other};
+	// Next unclaimed id block; threads take ComponentRegistry::kIdBlock ids at a time.
 	static std::atomic<uint64_t> nextId;
-
-	// Owner: when set, this component is owned by exactly one Group. Use weak_ptr to avoid cycles.
-	std::weak_ptr<Group> owner_;
+	static std::atomic<uint64_t> topologyEpoch;
+
+private:
+	friend class ComponentTree;
+	friend class Inventory;
+	// Owner and children live in the tree: the parent node, when set, is the one owning Group.
+	ComponentTree::Handle node_;
+	// The Inventory holding this component at top level, or nullptr; kept by that Inventory.
+	Inventory* holder_{nullptr};
 };
 
 
@@ -1,6 +1,11 @@
 #pragma once
 #include "InventoryComponent.h"
+#include "PlantStore.h"
+#include "../Core/Symbol.h"
 #include "../Patterns/Observer/Subject.h"
+#include "../Patterns/Builder/PlantSpecification.h"
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -13,8 +18,10 @@ class Observer;
  * @class Plant
  * @brief Represents a single plant in the nursery (a "Leaf" in the Composite pattern).
  *
- * This class is a concrete implementation of InventoryComponent. It holds all the
- * intrinsic properties of a plant, such as health, water level, and age.
+ * This class is a concrete implementation of InventoryComponent. It holds the
+ * plant's identity (name, price) and is a thin view over one slot of a PlantStore,
+ * which keeps the per-day fields (age, health, water level, lifecycle stage) in
+ * contiguous columns so a whole nursery can be ticked in bulk.
  *
  * It plays multiple roles in other patterns:
  * - It is the "Context" for the State pattern, delegating its behavior to a PlantState object.
@@ -22,41 +29,63 @@ class Observer;
  */
 class Plant : public InventoryComponent, public Subject {
 private:
-	std::string name;
+	Symbol name;
 	double price;
-	int age;
-	int health;
-	int waterLevel;
-	// PlantState ownership: each plant owns its state object
-	std::unique_ptr<PlantState> currentState; // (State Pattern) The current state of the plant.
+	// Columnar storage backing age/health/waterLevel/stage; shared so it outlives its views.
+	std::shared_ptr<PlantStore> store;
+	PlantStore::Slot slot;
+	// When the plant was first stocked into an Inventory (see markStocked()); 0 until then.
+	uint64_t stockSequence{0};
+	static std::atomic<uint64_t> nextStockSequence;
+	// (State Pattern) The current state is the one-byte stage tag in the store;
+	// its behaviour is the shared PlantState::forStage() object.
 
 	// Observers are stored as weak_ptrs to avoid ownership cycles and dangling pointers.
 	std::vector<std::weak_ptr<Observer>> observers;
 
 public:
-	Plant(const std::string& name, double price);
-	~Plant() override = default;
+	// thirst: species-specific water lost per day. store: defaults to PlantStore::shared().
+	Plant(Symbol name, double price, int thirst, std::shared_ptr<PlantStore> store = nullptr);
+	~Plant() override;
+	Plant(const Plant&) = delete;
+	Plant& operator=(const Plant&) = delete;
 
 	// --- Overrides from InventoryComponent (Composite & Prototype) ---
-	std::string getName() const override;
-	double getPrice() const override;
+	// Defined inline so that calls through a final plant type (see ComponentVisitor.h) inline.
+	std::string_view nameView() const override { return name.view(); }
+	// The interned name: comparing two plants' names is a pointer compare.
+	Symbol getNameSymbol() const noexcept { return name; }
+	double getPrice() const override { return price; }
 	std::unique_ptr<Iterator> createIterator() override;
 	std::shared_ptr<InventoryComponent> clone() const override;
 	std::shared_ptr<InventoryComponent> blueprintClone() const override;
 	std::string serialize() const override;
 	void deserialize(const std::string& data) override;
-	std::string typeName() const override;
+	std::string_view typeNameView() const override;
+
+	// The live plant registered under 'id' (see ComponentRegistry), or nullptr if none or not a plant.
+	static std::shared_ptr<Plant> resolve(uint64_t id);
 
 	// --- Methods for State Pattern ---
 
 	/**
 	 * @brief Sets the plant's current lifecycle state.
-	 * @param state A unique_ptr to the new state object (ownership transferred).
+	 * @param state One of the shared behaviours returned by PlantState::forStage().
 	 */
-	void setState(std::unique_ptr<PlantState> state);
+	void setState(const PlantState& state);
+
+	// The shared behaviour for the plant's current stage.
+	const PlantState& getState() const;
+
+	// Lifecycle stage tag held in the store.
+	LifecycleStage getStage() const noexcept;
+	void setStage(LifecycleStage stage) noexcept;
 
 	/**
 	 * @brief The main update method called each day, which delegates to the current state.
+	 *
+	 * This is the object-per-plant path; PlantStore::tick() is its batched equivalent.
+	 * Observers are notified when the plant becomes thirsty or changes stage.
 	 */
 	void performDailyActivity();
 
@@ -64,6 +93,10 @@ public:
 
 	/**
 	 * @brief Attaches an observer to this plant.
+	 *
+	 * update() is only ever called on the thread driving the simulation. The
+	 * Nursery's day tick, serial or parallel, refreshes views from its tick units
+	 * and calls attached observers once the units have joined, in unit order.
 	 * @param observer The observer to attach (shared ownership retained by caller).
 	 */
 	void attach(const std::shared_ptr<Observer>& observer) override;
@@ -76,17 +109,57 @@ public:
 
 	/**
 	 * @brief Notifies all attached observers of a state change.
+	 *
+	 * Queues the plant for its predicate views (Inventory::stateChanged()), then
+	 * calls notifyObservers().
 	 */
 	void notify() override;
 
+	// The observer half of notify(): calls update() on every attached observer.
+	void notifyObservers();
+	// Whether any observer is attached; lets the day tick skip plants nobody observes.
+	bool hasObservers() const noexcept { return !observers.empty(); }
+
 	// Detach all observers (called by owner before removing plant)
 	void detachAllObservers() override;
 
 	// --- Plant-specific methods ---
 
+	// Per-day fields, read from and written to the backing PlantStore slot.
+	int getAge() const noexcept;
+	int getHealth() const noexcept;
+	int getWaterLevel() const noexcept;
+	int getThirst() const noexcept;
+	void setAge(int value) noexcept;
+	void setHealth(int value) noexcept;
+	void setWaterLevel(int value) noexcept;
+
+	const std::shared_ptr<PlantStore>& getStore() const noexcept { return store; }
+	PlantStore::Slot getSlot() const noexcept { return slot; }
+
+	// Whether a NurserySupervisor acts on this plant's batched events. Kept in the store slot,
+	// so it survives setId() and ends with the plant.
+	void setWatched(bool value) noexcept { store->setWatched(slot, value); }
+	bool isWatched() const noexcept { return store->watched(slot); }
+
+	// Stocking order across all inventories, for PlantIndex: a lower sequence was stocked
+	// earlier. Assigned the first time an Inventory indexes the plant and kept across moves
+	// and restocking; clones start unstocked. 0 until then.
+	uint64_t getStockSequence() const noexcept { return stockSequence; }
+	// Assigns the next sequence unless the plant already has one; returns it.
+	uint64_t markStocked() noexcept;
+
 	/**
 	 * @brief The specific watering logic for this type of plant (polymorphic).
 	 */
 	virtual void water() = 0;
+
+	// Care the species needs; matched against a customer's PlantSpecification.
+	virtual WaterLevel getWaterRequirement() const = 0;
+	virtual SunLevel getSunRequirement() const = 0;
+
+protected:
+	// Copies id and per-day fields from 'other'; used by snapshot clone() overrides.
+	void copyRuntimeStateFrom(const Plant& other);
 };
 
@@ -0,0 +1,250 @@
+#pragma once
+#include "../Patterns/State/LifecycleEngine.h"
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Forward declaration: each live slot remembers the Plant viewing it.
+class Plant;
+
+/**
+ * @class PlantStore
+ * @brief Columnar (structure-of-arrays) storage for the per-day plant fields.
+ *
+ * Every Plant is a thin view over one slot of a PlantStore: its age, health,
+ * water level, species thirst and lifecycle stage tag live in contiguous arrays
+ * here instead of inside the Plant object. This lets the daily tick advance a
+ * whole store with one branch-free loop per lifecycle stage rather than one
+ * virtual PlantState call per heap-allocated plant.
+ *
+ * Slots are recycled through a free list; a free slot carries the kFreeSlot
+ * stage tag so none of the per-stage loops ever touch it. Allocation and release
+ * are serialized internally; ticking and column access are not, so callers must
+ * not create or destroy plants in a store while it is being ticked.
+ *
+ * A slot may also be deferred: left behind across days on which it raises no
+ * event, and caught up by whoever deferred it before anything reads it. See defer().
+ */
+class PlantStore {
+public:
+	using Slot = uint32_t;
+
+	// Stage tag carried by unused slots; matches no LifecycleStage.
+	static constexpr uint8_t kFreeSlot = 0xFF;
+
+	// Bits recorded per slot by the most recent tick.
+	enum Event : uint8_t {
+		NoEvent = 0,
+		BecameThirsty = 1 << 0, // Water crossed below LifecycleRules::kThirstyThreshold.
+		StageChanged = 1 << 1   // The lifecycle stage tag changed.
+	};
+
+	/**
+	 * @struct RangeState
+	 * @brief Stage populations and lowest health and water level over a range of slots.
+	 *
+	 * Filled by tickRange() and fastForward() on request, so a caller ticking the
+	 * plants of one plot learns what the plot's aggregates need without another
+	 * walk (see Group::assignPlantState()). The minima are INT32_MAX for no plant.
+	 */
+	struct RangeState {
+		std::array<uint64_t, kLifecycleStageCount> stageCounts{};
+		int32_t minHealth{INT32_MAX};
+		int32_t minWaterLevel{INT32_MAX};
+	};
+
+	// syncedDay() of a slot that is not deferred.
+	static constexpr uint32_t kNotDeferred = UINT32_MAX;
+
+	PlantStore() = default;
+	~PlantStore() = default;
+	PlantStore(const PlantStore&) = delete;
+	PlantStore& operator=(const PlantStore&) = delete;
+
+	// Process-wide store used by plants constructed without an explicit store.
+	static const std::shared_ptr<PlantStore>& shared();
+
+	// Inert store holding snapshot clones (Plant::clone()); it is never ticked.
+	static const std::shared_ptr<PlantStore>& archive();
+
+	// Claims a slot initialised to a fresh seedling and binds it to 'view'.
+	Slot allocate(Plant* view, int32_t thirst);
+	// Returns a slot to the free list.
+	void release(Slot slot);
+	// Grows the columns so that 'count' more allocations need no reallocation.
+	void reserve(std::size_t count);
+
+	// Number of live slots / number of slots including free ones.
+	std::size_t size() const;
+	std::size_t capacity() const noexcept { return stages.size(); }
+
+	// --- Column access (no bounds checks; slot must be live) ---
+	int32_t age(Slot slot) const noexcept { return ages[slot]; }
+	int32_t health(Slot slot) const noexcept { return healths[slot]; }
+	int32_t waterLevel(Slot slot) const noexcept { return waterLevels[slot]; }
+	int32_t thirst(Slot slot) const noexcept { return thirsts[slot]; }
+	LifecycleStage stage(Slot slot) const noexcept { return static_cast<LifecycleStage>(stages[slot]); }
+	uint8_t events(Slot slot) const noexcept { return eventFlags[slot]; }
+	Plant* view(Slot slot) const noexcept { return views[slot]; }
+
+	// Setters also drop the slot's cached quietDays() answer and advance stateVersion().
+	// Unlike Plant's setters they do not mark the ComponentTree for incremental snapshots
+	// or the owning Group's aggregates.
+	void setAge(Slot slot, int32_t value) noexcept { ages[slot] = value; touched(slot); }
+	void setHealth(Slot slot, int32_t value) noexcept { healths[slot] = value; touched(slot); }
+	void setWaterLevel(Slot slot, int32_t value) noexcept { waterLevels[slot] = value; touched(slot); }
+	void setStage(Slot slot, LifecycleStage value) noexcept { stages[slot] = static_cast<uint8_t>(value); touched(slot); }
+
+	/**
+	 * @brief Process-wide version of the plant state no owning Group was told about.
+	 *
+	 * Changes after a setter call, or a tick or fast-forward that was not asked
+	 * for its RangeState. Group aggregates are kept per group (Plant's setters
+	 * and the Nursery's tick units report to the owning Group) and fall back to
+	 * a rebuild when this moves. Writers only raise a flag; the counter itself
+	 * moves when it is read.
+	 */
+	static uint64_t stateVersion() noexcept;
+	// Advances stateVersion(); for state changes made behind the owning Groups' backs.
+	static void markStateChanged() noexcept { stateDirty.store(true, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Advances every live slot by one day.
+	 *
+	 * Runs one vectorizable pass per living stage followed by the LifecycleEngine
+	 * transition pass, and records per-slot Event bits that can be read back with
+	 * forEachEvent().
+	 * @param extraWaterLoss Additional water removed from every ticked slot.
+	 * @param counters Optional; receives stage populations and transition counts.
+	 */
+	void tick(int32_t extraWaterLoss = 0, LifecycleCounters* counters = nullptr);
+
+	/**
+	 * @brief Same as tick(), restricted to the slots in [begin, end).
+	 * @param state Optional; receives the range's state after the tick. The caller then
+	 * reports it to whoever derives data from it, and stateVersion() does not move.
+	 */
+	void tickRange(Slot begin, Slot end, int32_t extraWaterLoss = 0, LifecycleCounters* counters = nullptr,
+		RangeState* state = nullptr);
+
+	// Stage populations and minima of the live slots in [begin, end), added into 'state'.
+	void summarize(Slot begin, Slot end, RangeState& state) const noexcept;
+
+	/**
+	 * @brief Counts the days after 'today' on which no slot in [begin, end) would raise an Event.
+	 *
+	 * Evaluated in closed form from each slot's age, health, water level and the
+	 * LifecycleRules tables: water falls linearly, health rises until the soil
+	 * turns dry and falls afterwards, so the first thirst crossing and the first
+	 * day inside a transition row can be solved for directly. The answer is kept
+	 * per slot and reused on later calls until one of the slot's setters runs
+	 * (or forgetQuietDays() is called), so only changed slots are re-solved.
+	 * @param weatherPrefix weatherPrefix[k] - weatherPrefix[0] is the extra water loss summed over
+	 * the k days after 'today', so one array can serve slots brought up to different days.
+	 * @param days Horizon; the result is at most this (and weatherPrefix holds days + 1 entries).
+	 */
+	uint32_t quietDays(Slot begin, Slot end, uint32_t today, const int32_t* weatherPrefix, uint32_t days);
+
+	// Drops the answers quietDays() kept for [begin, end), e.g. because their weather stream changed.
+	void forgetQuietDays(Slot begin, Slot end);
+
+	/**
+	 * @brief Advances [begin, end) by 'days' days that quietDays() reported as event-free.
+	 *
+	 * Leaves every slot exactly as 'days' calls of tickRange() would have, at a
+	 * cost independent of 'days'. weatherPrefix is read as by quietDays().
+	 * @param counters Optional; receives stage populations (no transitions happen).
+	 * @param state Optional; as for tickRange().
+	 */
+	void fastForward(Slot begin, Slot end, const int32_t* weatherPrefix, uint32_t days,
+		LifecycleCounters* counters = nullptr, RangeState* state = nullptr);
+
+	/**
+	 * @brief Marks 'slot' as up to date through 'day' and left behind after that.
+	 *
+	 * The caller promises the slot raises no event until it catches it up with
+	 * fastForward(), which it must do before anyone else reads the slot: getters,
+	 * Plant's included, read the columns as they are. Setters list the slot for
+	 * takeRescheduled(), since the promise no longer holds. Allocation and release
+	 * leave a slot not deferred.
+	 */
+	void defer(Slot slot, uint32_t day) noexcept { syncedDays[slot] = day; }
+	void undefer(Slot slot) noexcept { syncedDays[slot] = kNotDeferred; }
+	bool deferred(Slot slot) const noexcept { return syncedDays[slot] != kNotDeferred; }
+	uint32_t syncedDay(Slot slot) const noexcept { return syncedDays[slot]; }
+
+	// Whether a NurserySupervisor acts on the slot's plant events. Allocation and release clear it.
+	void setWatched(Slot slot, bool value) noexcept { watchedFlags[slot] = value ? 1 : 0; }
+	bool watched(Slot slot) const noexcept { return watchedFlags[slot] != 0; }
+
+	// Deferred slots written since the last call, in write order (possibly repeated).
+	std::vector<Slot> takeRescheduled() noexcept {
+		std::vector<Slot> slots;
+		slots.swap(rescheduled);
+		return slots;
+	}
+
+	// Calls fn(Plant*, uint8_t events) for every slot in [begin, end) with events set by the last tick.
+	template <typename Fn>
+	void forEachEvent(Slot begin, Slot end, Fn&& fn) const {
+		for (Slot slot = begin; slot < end; ++slot) {
+			if (eventFlags[slot] != NoEvent) fn(views[slot], eventFlags[slot]);
+		}
+	}
+
+	template <typename Fn>
+	void forEachEvent(Fn&& fn) const { forEachEvent(0, static_cast<Slot>(stages.size()), fn); }
+
+private:
+	// Plant's setters report to the owning Group themselves (Group::plantStateChanged()).
+	friend class Plant;
+	void assignAge(Slot slot, int32_t value) noexcept { ages[slot] = value; resolveAgain(slot); }
+	void assignHealth(Slot slot, int32_t value) noexcept { healths[slot] = value; resolveAgain(slot); }
+	void assignWaterLevel(Slot slot, int32_t value) noexcept { waterLevels[slot] = value; resolveAgain(slot); }
+	void assignStage(Slot slot, LifecycleStage value) noexcept {
+		stages[slot] = static_cast<uint8_t>(value);
+		resolveAgain(slot);
+	}
+	void touched(Slot slot) noexcept {
+		resolveAgain(slot);
+		markStateChanged();
+	}
+	void resolveAgain(Slot slot) noexcept {
+		quietThrough[slot] = kQuietUnknown;
+		if (deferred(slot)) rescheduled.push_back(slot);
+	}
+
+	// Applies the daily rule of 'stage' to the matching slots in [begin, end).
+	void tickStage(LifecycleStage stage, Slot begin, Slot end, int32_t extraWaterLoss);
+	// Moves slots in [begin, end) to their next lifecycle stage.
+	void applyTransitions(Slot begin, Slot end, LifecycleCounters* counters);
+
+	std::vector<int32_t> ages;
+	std::vector<int32_t> healths;
+	std::vector<int32_t> waterLevels;
+	std::vector<int32_t> thirsts;
+	std::vector<uint8_t> stages;
+	std::vector<uint8_t> eventFlags;
+	std::vector<Plant*> views;
+
+	// quietDays() cache: the slot raises no event up to and including day quietThrough[slot].
+	// With quietExact set its first event is the day after; otherwise that day ended the horizon.
+	static constexpr uint32_t kQuietUnknown = 0;
+	std::vector<uint32_t> quietThrough;
+	std::vector<uint8_t> quietExact;
+
+	// Deferred days: the last day each slot was brought up to (kNotDeferred if none).
+	std::vector<uint32_t> syncedDays;
+	std::vector<Slot> rescheduled;
+	std::vector<uint8_t> watchedFlags;
+
+	std::vector<Slot> freeSlots;
+	mutable std::mutex allocationMutex;
+
+	static inline std::atomic<bool> stateDirty{false};
+	static inline std::atomic<uint64_t> stateEpoch{0};
+};
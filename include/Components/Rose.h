@@ -2,15 +2,19 @@
 #include "Plant.h"
 #include <memory>
 
-class Rose : public Plant {
+class Rose final : public Plant {
 public:
-    Rose(const std::string& name, double price);
+    Rose(Symbol name, double price, std::shared_ptr<PlantStore> store = nullptr);
     ~Rose() override = default;
 
     void water() override;
+    // Waters 'count' plants with one non-virtual loop (used by BatchWaterCommand).
+    static void waterAll(Rose* const* roses, std::size_t count);
+    WaterLevel getWaterRequirement() const override;
+    SunLevel getSunRequirement() const override;
     std::shared_ptr<InventoryComponent> clone() const override;
     std::shared_ptr<InventoryComponent> blueprintClone() const override;
     std::string serialize() const override;
     void deserialize(const std::string& data) override;
-    std::string typeName() const override;
+    std::string_view typeNameView() const override;
 };
@@ -0,0 +1,90 @@
+#pragma once
+#include "InventoryComponent.h"
+#include "../Core/Symbol.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TypeRegistry
+ * @brief Compact integer ids for component types, dispatching on them through flat arrays.
+ *
+ * Each concrete component type is registered once under its typeNameView() and
+ * gets the next ComponentTypeId. serialize() writes that id as a record's
+ * "type" instead of the name, instantiate() turns a record back into a
+ * component with one index into the type table, and a component finds its own
+ * id by indexing with its ComponentKind. Names are only hashed for
+ * string-keyed callers (Nursery::stockPlant(name)) and for records written
+ * before ids existed.
+ *
+ * The built-in types are registered first, in a fixed order, so their ids are
+ * the same in every run and every save file. Types registered later get the
+ * next ids in registration order; register them in the same order before any
+ * of their components is serialized or loaded. Registration takes a lock but
+ * lookups do not, so register at startup.
+ */
+class TypeRegistry {
+public:
+	// Builds a component from a serialized record of the type, taking its constructor
+	// arguments (name, price, wrapped component, ...) from the record.
+	using Create = std::shared_ptr<InventoryComponent> (*)(const std::string& record);
+
+	struct TypeInfo {
+		Symbol name;
+		ComponentKind kind{ComponentKind::Other};
+		Create create{nullptr};
+	};
+
+	static constexpr ComponentTypeId kUnregistered = 0xFFFF;
+
+	// Process-wide registry holding the built-in types. Never destroyed.
+	static TypeRegistry& shared();
+
+	/**
+	 * @brief Registers a type and returns its new id.
+	 *
+	 * Pass ComponentKind::Other for types outside the built-in set; they are found by name.
+	 * @throws std::invalid_argument if the name, or a kind other than Other, is taken.
+	 */
+	ComponentTypeId add(Symbol name, ComponentKind kind, Create create);
+
+	// kUnregistered when no type was registered under the kind (always for Other) or name.
+	ComponentTypeId idOf(ComponentKind kind) const noexcept { return byKind[static_cast<std::size_t>(kind)]; }
+	ComponentTypeId idOf(std::string_view name) const;
+	// The id of component's type: by kind, falling back to its type name for kind Other.
+	ComponentTypeId idOf(const InventoryComponent& component) const;
+
+	// No bounds check; 'id' must be registered.
+	const TypeInfo& info(ComponentTypeId id) const noexcept { return types[id]; }
+	std::size_t size() const noexcept { return types.size(); }
+
+	/**
+	 * @brief The type a record's "type" field names: an id, or a type name in older records.
+	 * @throws std::runtime_error if the field is missing or names no registered type.
+	 */
+	ComponentTypeId typeOfRecord(const std::string& record) const;
+
+	/**
+	 * @brief Builds the component a serialized record describes.
+	 *
+	 * Dispatches on the record's type through the type table, then hands the
+	 * record to the new component's deserialize().
+	 * @throws std::runtime_error if the record is of no registered type.
+	 */
+	std::shared_ptr<InventoryComponent> instantiate(const std::string& record) const;
+
+private:
+	TypeRegistry();
+	TypeRegistry(const TypeRegistry&) = delete;
+	TypeRegistry& operator=(const TypeRegistry&) = delete;
+
+	std::vector<TypeInfo> types; // indexed by ComponentTypeId
+	std::array<ComponentTypeId, kComponentKindCount> byKind;
+	std::unordered_map<Symbol, ComponentTypeId, Symbol::Hash> byName;
+	std::mutex registrationMutex;
+};
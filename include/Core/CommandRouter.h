@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../Patterns/Command/Command.h"
+
+class Staff;
+
+/**
+ * @class CommandRouter
+ * @brief Routing table from Command::Kind to the pool of staff able to perform it.
+ *
+ * Replaces the Staff chain walk in the day loop: dispatch() indexes the pool by
+ * kind and hands the command to the least-loaded member whose remaining
+ * Staff::getDailyCapacity() fits its Command::workUnits(). A command larger than
+ * a member's whole daily capacity only goes to a member with no work yet that
+ * day, so only such commands push a member past its capacity. Each pool is a
+ * min-heap on the day's load; a member shared by several pools may carry a stale
+ * key in one of them, which is refreshed lazily when it reaches the top.
+ *
+ * Commands no member can take today are returned as Deferred (the caller retries
+ * them later); commands of a kind nobody performs are Dropped (marked Failed).
+ */
+class CommandRouter {
+public:
+	enum class Outcome { Performed, Deferred, Dropped };
+
+	// Work done by one staff member since it was added.
+	struct StaffStats {
+		std::shared_ptr<Staff> staff;
+		uint64_t commands{0};
+		uint64_t workUnits{0};
+		uint64_t capacityUnits{0}; // summed daily capacity over the days it had a limit
+		uint64_t days{0};
+		// Fraction of the available capacity used; 0 for unlimited staff. Above 1 only
+		// when the member was given commands larger than its daily capacity.
+		double utilization() const noexcept {
+			return capacityUnits ? static_cast<double>(workUnits) / static_cast<double>(capacityUnits) : 0.0;
+		}
+	};
+
+	struct KindStats {
+		uint64_t performed{0};
+		uint64_t deferred{0};
+		uint64_t dropped{0};
+	};
+
+	CommandRouter();
+	~CommandRouter();
+
+	// Registers 'staff' in the pool of every kind it can handle.
+	void addStaff(const std::shared_ptr<Staff>& staff);
+
+	// Starts a new working day: clears every member's load.
+	void startDay();
+
+	/**
+	 * @brief Routes one command.
+	 *
+	 * Performed: the command was executed and consumed. Deferred: no capable
+	 * member has room for it today; 'cmd' is left untouched for the caller to requeue.
+	 * Dropped: no member handles this kind; the command is marked Failed and consumed.
+	 */
+	Outcome dispatch(std::unique_ptr<Command>& cmd);
+
+	const std::vector<StaffStats>& staffStats() const noexcept { return stats; }
+	const KindStats& kindStats(Command::Kind kind) const noexcept { return kinds[static_cast<std::size_t>(kind)]; }
+
+private:
+	// (load today, member index); a min-heap of these forms each pool.
+	using PoolEntry = std::pair<std::size_t, uint32_t>;
+
+	struct Pool {
+		std::vector<uint32_t> members;
+		std::vector<PoolEntry> heap;
+	};
+
+	std::vector<StaffStats> stats;
+	std::vector<std::size_t> loadToday;
+	std::vector<PoolEntry> skipped; // dispatch()'s scratch: members too full for the current command
+	std::array<Pool, Command::kKindCount> pools;
+	std::array<KindStats, Command::kKindCount> kinds;
+};
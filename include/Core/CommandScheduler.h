@@ -0,0 +1,167 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "../Patterns/Command/Command.h"
+
+/**
+ * @class CommandScheduler
+ * @brief Replaces the FIFO request queue: orders ready commands by urgency and
+ * deadline, and parks commands scheduled for a future day on a timing wheel.
+ *
+ * Ready commands sit in a binary heap keyed by (Command::urgency() descending,
+ * deadline day ascending, submission order), so watering a dying plant no longer
+ * waits behind routine customer orders. Urgency is sampled once, at submission.
+ *
+ * Deferred commands go onto a hierarchical timing wheel with day granularity:
+ * three levels of kWheelSlots slots cover 1, 64 and 4096 days per slot, and
+ * anything further out waits in an overflow list. Scheduling is O(1); advancing
+ * one day expires one level-0 slot and, on a level boundary, cascades one slot
+ * of the next level down.
+ *
+ * A command with a non-zero Command::mergeKey() is first offered to the queued
+ * command with the same key that becomes ready on the same day: either absorbs
+ * the other (Command::absorb()), and the surviving entry takes the higher
+ * urgency and earlier deadline of the two. Commands requeued by the caller,
+ * such as ones the router deferred, merge the same way. The queued command of
+ * each key knows where its entry sits, so a merge costs O(log n) whatever the
+ * queue holds.
+ *
+ * The time between a command becoming ready and being popped is recorded per
+ * Command::typeName() (see QueueWaitStats).
+ */
+class CommandScheduler {
+public:
+	static constexpr std::size_t kWheelBits = 6;
+	static constexpr std::size_t kWheelSlots = std::size_t{1} << kWheelBits;
+	static constexpr std::size_t kWheelLevels = 3;
+
+	/**
+	 * @struct QueueWaitStats
+	 * @brief Ready-to-dispatch latency of one command type.
+	 *
+	 * Wall-clock waits go into power-of-two nanosecond buckets, so percentiles are
+	 * upper bounds accurate to a factor of two. daysLate sums how many days after
+	 * their deadline commands were dispatched.
+	 */
+	struct QueueWaitStats {
+		const char* typeName{nullptr};
+		uint64_t count{0};
+		uint64_t totalNs{0};
+		uint64_t maxNs{0};
+		uint64_t daysLate{0};
+		std::array<uint64_t, 64> histogram{};
+
+		void record(uint64_t waitNs, uint64_t lateDays) noexcept;
+		double meanNs() const noexcept { return count ? static_cast<double>(totalNs) / static_cast<double>(count) : 0.0; }
+		// Upper bound of the bucket holding the q-th quantile (q in [0, 1]).
+		uint64_t percentileNs(double q) const noexcept;
+	};
+
+	CommandScheduler();
+	~CommandScheduler();
+	CommandScheduler(const CommandScheduler&) = delete;
+	CommandScheduler& operator=(const CommandScheduler&) = delete;
+
+	/**
+	 * @brief Queues a command to run on 'dueDay' (immediately ready if that is not in the future).
+	 * @param deadline Day by which it should run; ties on urgency favour the earliest. Defaults to dueDay.
+	 */
+	void schedule(std::unique_ptr<Command> cmd, uint64_t dueDay, uint64_t deadline);
+	void schedule(std::unique_ptr<Command> cmd, uint64_t dueDay) { schedule(std::move(cmd), dueDay, dueDay); }
+
+	// Queues a command that is ready now.
+	void submit(std::unique_ptr<Command> cmd) { schedule(std::move(cmd), today, today); }
+
+	// Moves the clock forward to 'day', releasing every deferred command due on or before it.
+	void advanceTo(uint64_t day);
+	uint64_t currentDay() const noexcept { return today; }
+
+	// Removes the most urgent ready command, or returns nullptr if none is ready.
+	std::unique_ptr<Command> pop();
+
+	// Earliest day a deferred command is due, or UINT64_MAX if none is deferred. Linear in deferredCount().
+	uint64_t nextDueDay() const noexcept;
+
+	// Whether a queued command with mergeKey() 'key' becomes ready on the same day as one due on 'dueDay'.
+	bool holdsMergeable(uint64_t key, uint64_t dueDay) const;
+	// Commands absorbed into an already queued one since construction.
+	uint64_t mergedCount() const noexcept { return merged; }
+
+	std::size_t readyCount() const noexcept { return ready.size(); }
+	std::size_t deferredCount() const noexcept { return deferred; }
+	std::size_t size() const noexcept { return ready.size() + deferred; }
+	bool empty() const noexcept { return size() == 0; }
+
+	// Calls fn(const Command&, uint64_t dueDay) for every queued command (ready ones first, in no particular order).
+	template <typename Fn>
+	void forEach(Fn&& fn) const {
+		for (const auto& entry : ready) fn(*entry.command, entry.dueDay);
+		for (const auto& level : wheel) {
+			for (const auto& slot : level) {
+				for (const auto& entry : slot) fn(*entry.command, entry.dueDay);
+			}
+		}
+		for (const auto& entry : overflow) fn(*entry.command, entry.dueDay);
+	}
+
+	// Queue-wait statistics, one entry per command type seen so far.
+	const std::vector<QueueWaitStats>& waitStats() const noexcept { return stats; }
+	void resetWaitStats() noexcept { stats.clear(); }
+
+private:
+	struct Entry;
+
+	// The queued command a newly scheduled one is merged into, and where its entry sits.
+	struct Mergeable {
+		Command* command;
+		uint64_t readyDay;          // max(dueDay, day it was scheduled)
+		std::vector<Entry>* bucket; // wheel slot or overflow list holding the entry; null while ready
+		std::size_t index;          // of the entry in 'bucket', or in 'ready'
+	};
+
+	struct Entry {
+		std::unique_ptr<Command> command;
+		int urgency;
+		uint64_t dueDay;
+		uint64_t deadline;
+		uint64_t sequence;
+		uint64_t mergeKey; // as sampled at scheduling; the command's own may change while queued
+		std::chrono::steady_clock::time_point readySince;
+		Mergeable* merge;  // the mergeable record pointing at this entry, if any; kept up to date as it moves
+	};
+
+	// Heap order: true if 'a' should run after 'b'.
+	static bool runsAfter(const Entry& a, const Entry& b) noexcept;
+
+	// Offers 'cmd' to the queued command sharing its mergeKey() 'key'; true if one absorbed the other.
+	bool mergeIntoQueued(std::unique_ptr<Command>& cmd, uint64_t key, int urgency, uint64_t dueDay, uint64_t deadline);
+	// The queued entry a mergeable record points at.
+	Entry& entryOf(const Mergeable& record) { return record.bucket ? (*record.bucket)[record.index] : ready[record.index]; }
+	void pushReady(Entry entry);
+	// Heap moves of 'ready' that keep each entry's Mergeable::index current.
+	void siftUp(std::size_t index);
+	void siftDown(std::size_t index);
+	// Moves 'entry' to 'bucket' (null: 'ready') at 'index' and updates its mergeable record.
+	void settle(Entry&& entry, std::vector<Entry>* bucket, std::size_t index);
+	// Files a deferred entry into the wheel level/slot matching its distance from today.
+	void place(Entry entry);
+	// Re-files every entry of one slot (the clock has moved into its range).
+	void cascade(std::vector<Entry>& slot);
+	QueueWaitStats& statsFor(const char* typeName);
+
+	std::vector<Entry> ready; // binary heap, see runsAfter()
+	std::array<std::array<std::vector<Entry>, kWheelSlots>, kWheelLevels> wheel;
+	std::vector<Entry> overflow; // due beyond the top wheel level's range
+	std::size_t deferred{0};
+	uint64_t today{0};
+	uint64_t nextSequence{0};
+	// By Command::mergeKey(); node-based, so Entry::merge stays valid while others come and go.
+	std::unordered_map<uint64_t, Mergeable> mergeable;
+	uint64_t merged{0};
+	std::vector<QueueWaitStats> stats;
+};
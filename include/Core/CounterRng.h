@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @class CounterRng
+ * @brief Stateless counter-based random stream.
+ *
+ * Value n of stream s is a pure function of (seed, s, n): a SplitMix64-style
+ * finaliser applied to the mixed key. Because nothing is carried between draws,
+ * any thread can draw any stream's values in any order and still get exactly
+ * what a serial run would have drawn. The simulation keys one stream per plot
+ * (partition) and uses the day number as the counter.
+ */
+class CounterRng {
+private:
+	uint64_t key;
+
+	static constexpr uint64_t mix(uint64_t value) noexcept {
+		value += 0x9E3779B97F4A7C15ull;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
+
+public:
+	constexpr CounterRng(uint64_t seed, uint64_t stream) noexcept : key(mix(seed ^ mix(stream))) {}
+
+	// The counter-th 64-bit value of this stream.
+	constexpr uint64_t operator()(uint64_t counter) const noexcept { return mix(key + mix(counter)); }
+
+	// The counter-th value of this stream reduced to [0, bound). bound must be non-zero.
+	constexpr uint32_t uniform(uint64_t counter, uint32_t bound) const noexcept {
+		return static_cast<uint32_t>(((*this)(counter) >> 32) * bound >> 32);
+	}
+};
@@ -1,26 +1,97 @@
 
 #pragma once
 #include "../Components/InventoryComponent.h"
+#include "../Components/ComponentTree.h"
+#include "../Components/Group.h"
+#include "PlantIndex.h"
+#include "../Patterns/Iterator/LazyPreOrderIterator.h"
+#include "../Patterns/Iterator/LazyLevelOrderIterator.h"
+#include "../Patterns/Iterator/TraversalFilter.h"
+#include <atomic>
+#include <string>
 #include <vector>
 #include <memory>
 
+class TraversalStrategy;
+class Plant;
+
 /**
  * @class Inventory
  * @brief Manages the collection of all InventoryComponents in the nursery.
  * 
  * This class is the top-level container for our Composite structure. It holds
  * the root-level plants and groups.
+ *
+ * It also keeps a PlantIndex over every plant in its owned subtrees so that
+ * customer requests are matched without walking the inventory, and keeps the
+ * predicate views created by createView() up to date.
  */
 class Inventory : public std::enable_shared_from_this<Inventory> {
 private:
 	// Inventory owns its top-level components (shared ownership for flexibility).
 	std::vector<std::shared_ptr<InventoryComponent>> components;
+	PlantIndex plantIndex;
+	// Predicate views selecting from this inventory (see createView()).
+	std::vector<std::weak_ptr<Group>> views;
+
+	// Number of live views bound to any inventory; lets Plant::notify() skip the lookup.
+	// Kept by Group::bind() and ~Group(), so views that die are uncounted at once.
+	static std::atomic<std::size_t> registeredViews;
+	// Group counts its bound views and batches track()/untrack() in moveAll().
+	friend class Group;
+
+	// Indexes 'component' and its subtree, which just entered this inventory.
+	void track(InventoryComponent& component);
+	// Drops 'component' and its subtree, which is leaving, from the index and views.
+	void untrack(const InventoryComponent& component);
+	// The same for 'count' components at once, with one pass per view over all of them.
+	void track(InventoryComponent* const* moved, std::size_t count);
+	void untrack(const InventoryComponent* const* moved, std::size_t count);
 
 public:
 	Inventory();
 	~Inventory();
+	Inventory(const Inventory&) = delete;
+	Inventory& operator=(const Inventory&) = delete;
 
+	// Adds a top-level component; a component owned by a Group is detached from it first.
 	void add(const std::shared_ptr<InventoryComponent>& component);
 	void remove(const std::shared_ptr<InventoryComponent>& component);
-	std::unique_ptr<Iterator> createIterator(); // Will create a CompositeIterator for the whole inventory.
+
+	// Top-level components in insertion order. No copies are made.
+	const std::vector<std::shared_ptr<InventoryComponent>>& getComponents() const noexcept { return components; }
+	// Pre-order over every top-level component and its subtree, as a snapshot taken now.
+	std::unique_ptr<Iterator> createIterator();
+	// Pre-order over the components 'filter' matches, skipping subtrees its bound rules out.
+	std::unique_ptr<Iterator> createIterator(TraversalFilter filter);
+	// The same walks without a snapshot: non-owning, lazy, the tree must not change meanwhile.
+	LazyPreOrderIterator walkPreOrder() const { return LazyPreOrderIterator(components); }
+	LazyLevelOrderIterator walkLevelOrder() const { return LazyLevelOrderIterator(components); }
+
+	// ComponentTree nodes of every top-level component and its owned subtree, in 'strategy' order.
+	// Valid while ComponentTree::layoutGeneration() is unchanged.
+	std::vector<ComponentTree::Handle> collectNodes(const TraversalStrategy& strategy) const;
+
+	// Whether 'component' is a top-level component or sits in the owned subtree of one.
+	bool contains(const InventoryComponent& component) const;
+	// The inventory whose owned subtrees hold 'component', or nullptr.
+	static Inventory* holding(const InventoryComponent& component);
+
+	// Longest-stocked living plant needing at most 'maxWater' and 'maxSun' (and named
+	// 'name' unless empty), found through the PlantIndex; nullptr if none.
+	std::shared_ptr<Plant> findAvailable(WaterLevel maxWater, SunLevel maxSun, const std::string& name = "");
+	const PlantIndex& getPlantIndex() const noexcept { return plantIndex; }
+
+	// A predicate view holding exactly the plants of this inventory for which 'predicate'
+	// holds, kept current as plants come, go and report events. The view is not added
+	// to the inventory; emptied if the inventory is destroyed first.
+	std::shared_ptr<Group> createView(const std::string& name, Group::Predicate predicate);
+
+	// Called by InventoryComponent::setOwner() once 'component' has a new owner: if that
+	// places it inside an Inventory, its plants are indexed there.
+	static void placed(InventoryComponent& component);
+	// Called by InventoryComponent::setOwner() before 'component' leaves its owner.
+	static void leaving(const InventoryComponent& component);
+	// Called by Plant::notify(): views of the plant's inventory re-evaluate it before their next read.
+	static void stateChanged(Plant& plant);
 };
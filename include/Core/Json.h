@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Json
+ * @brief Minimal helpers for the hand-written JSON produced by serialize().
+ *
+ * The project avoids an external JSON dependency (see HEADER_GUIDE.md); these
+ * helpers cover the only tricky parts of emitting it, string escaping and
+ * round-trippable numbers, plus just enough reading to pick fields back out of
+ * the records serialize() writes.
+ */
+namespace Json {
+
+// Returns 'text' as a quoted, escaped JSON string literal.
+std::string quote(std::string_view text);
+
+// Formats a double so that parsing it back yields the same value.
+std::string number(double value);
+
+// The raw text of the value 'object' (a JSON object) holds under 'key', or an empty
+// view when there is none. Only the top level is searched; nothing is validated.
+std::string_view field(std::string_view object, std::string_view key);
+
+// Reverses quote(); returns 'literal' unchanged when it is not a quoted string.
+std::string unquote(std::string_view literal);
+
+} // namespace Json
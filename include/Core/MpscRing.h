@@ -0,0 +1,106 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+/**
+ * @class MpscRing
+ * @brief Bounded lock-free multi-producer / single-consumer ring buffer.
+ *
+ * Dmitry Vyukov's bounded queue specialised for one consumer: each cell carries
+ * a sequence number that tells producers whether it is free for the position
+ * they claimed and tells the consumer whether it has been published. Producers
+ * claim positions with one compare-exchange on the tail; the consumer needs no
+ * read-modify-write at all. tryPush() fails instead of blocking when the ring is
+ * full, leaving the back-pressure policy to the caller.
+ *
+ * Any number of threads may call tryPush(); tryPop() and drain() must only ever
+ * be called from one thread at a time.
+ */
+template <typename T>
+class MpscRing {
+public:
+	// capacity is rounded up to a power of two (at least 2).
+	explicit MpscRing(std::size_t capacity) {
+		std::size_t size = 2;
+		while (size < capacity) size <<= 1;
+		mask = size - 1;
+		cells.reset(new Cell[size]);
+		for (std::size_t i = 0; i < size; ++i) cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	MpscRing(const MpscRing&) = delete;
+	MpscRing& operator=(const MpscRing&) = delete;
+
+	std::size_t capacity() const noexcept { return mask + 1; }
+
+	// Items claimed but not yet consumed, including ones still being written; exact only when no producer is active.
+	std::size_t sizeApprox() const noexcept {
+		return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+	}
+
+	// Consumer only: true when every position a producer has claimed so far has been consumed,
+	// i.e. no cell is still being written. A push that starts later may of course follow.
+	bool empty() const noexcept {
+		return tail.load(std::memory_order_acquire) == head.load(std::memory_order_relaxed);
+	}
+
+	// Enqueues 'value' (moved from only on success). Returns false if the ring is full.
+	bool tryPush(T&& value) {
+		std::size_t position = tail.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell& cell = cells[position & mask];
+			const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const auto lag = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+			if (lag == 0) {
+				if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					cell.value = std::move(value);
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (lag < 0) {
+				return false; // the consumer has not freed this cell yet: full
+			} else {
+				position = tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Consumer only: dequeues into 'out'. Returns false if nothing is published at the head.
+	bool tryPop(T& out) {
+		const std::size_t position = head.load(std::memory_order_relaxed);
+		Cell& cell = cells[position & mask];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1) return false;
+		out = std::move(cell.value);
+		cell.sequence.store(position + mask + 1, std::memory_order_release);
+		head.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer only: calls fn(T&&) for up to maxItems published items, in ring order.
+	template <typename Fn>
+	std::size_t drain(Fn&& fn, std::size_t maxItems = std::numeric_limits<std::size_t>::max()) {
+		std::size_t taken = 0;
+		T item{};
+		while (taken < maxItems && tryPop(item)) {
+			fn(std::move(item));
+			++taken;
+		}
+		return taken;
+	}
+
+private:
+	struct Cell {
+		std::atomic<std::size_t> sequence{0};
+		T value{};
+	};
+
+	std::unique_ptr<Cell[]> cells;
+	std::size_t mask{0};
+	// Producers and the consumer write different ends; keep them off each other's cache line.
+	alignas(64) std::atomic<std::size_t> tail{0};
+	alignas(64) std::atomic<std::size_t> head{0};
+};
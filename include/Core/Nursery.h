@@ -3,9 +3,20 @@
 
 #include <string>
 #include <vector>
-#include <queue>
-#include <map>
 #include <memory>
+#include <chrono>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include "../Patterns/State/LifecycleEngine.h"
+#include "CommandScheduler.h"
+#include "MpscRing.h"
+#include "CommandRouter.h"
+#include "../Components/InventoryComponent.h"
+#include "../Patterns/Observer/PlantEventBus.h"
 
 // Include necessary component and pattern interfaces.
 // Use forward declarations where possible to reduce compilation dependencies.
@@ -16,6 +27,12 @@ class PlantFactory;
 class PlantSpecificationBuilder;
 class Command;
 class Memento;
+class SnapshotRecorder;
+class Group;
+class Plant;
+class PlantStore;
+class Customer;
+class ThreadPool;
 
 /**
  * @class Nursery
@@ -30,21 +47,81 @@ class Memento;
  * - Holding the central `RequestQueue` for commands.
  * - Using factories to create new plants and builders to create customer requests.
  * - Acting as the "Originator" for the Memento pattern to save/load state.
+ *
+ * The Nursery must be owned by a std::shared_ptr: its supervisor holds a weak
+ * reference back to it.
  */
 class Nursery : public std::enable_shared_from_this<Nursery> {
+public:
+	// The timed sections of a simulated day, in the order they run.
+	enum class Phase : uint8_t { Tick, SpawnCustomers, ProcessRequests };
+	// Receives the wall-clock duration of each phase as it completes.
+	using PhaseTimer = std::function<void(Phase, std::chrono::nanoseconds)>;
+
 private:
 	int currentDay;
     
 	// Owned Subsystems
 	std::shared_ptr<Inventory> inventory;
-	// Head of the Chain of Responsibility
-	std::shared_ptr<Staff> staffChainHead;
+	// Routes each command kind to the least-loaded capable staff member (no chain walk).
+	CommandRouter staffRouter;
 	std::shared_ptr<NurserySupervisor> supervisor;
+	// Change records of ticked plants, published to the supervisor once per tick.
+	PlantEventBus plantEvents;
 
 	// Data Structures
-	// Nursery owns commands placed into its queue.
-	std::queue<std::unique_ptr<Command>> requestQueue;
-	std::map<std::string, std::shared_ptr<PlantFactory>> plantFactories;
+	// Nursery owns commands placed into its scheduler (urgency-ordered, with deferred days).
+	CommandScheduler requestQueue;
+
+	// A submitted command and how many days ahead of the drain day it is due.
+	struct PendingRequest {
+		std::unique_ptr<Command> command;
+		unsigned daysAhead{0};
+	};
+	// Submission path: any thread pushes here, the simulation thread drains into requestQueue.
+	MpscRing<PendingRequest> requestInbox;
+	// Spill-over while the inbox is full; once used, later submissions follow it to keep their order.
+	// It is only drained once the ring is empty, claimed-but-unpublished cells included, so no
+	// producer's spilled command overtakes one it put in the ring earlier.
+	std::mutex inboxOverflowMutex;
+	std::vector<PendingRequest> inboxOverflow;
+	std::atomic<bool> inboxOverflowing;
+	std::atomic<std::size_t> inboxOverflowSize; // inboxOverflow.size(), readable without the mutex
+	uint64_t coalescedRequests; // WaterPlantCommands absorbed by coalescing (duplicates and batch members)
+	// Where addRequest() sends this nursery's commands from stagingThread while publishPlantEvents()
+	// delivers plant events; other threads, and other nurseries, keep using the inbox.
+	std::vector<PendingRequest>* stagedRequests;
+	std::atomic<std::thread::id> stagingThread; // default id (no thread) outside of delivery
+	// Indexed by ComponentTypeId (see TypeRegistry); null for types without a factory.
+	std::vector<std::shared_ptr<PlantFactory>> plantFactories;
+	// Types that have a factory, ordered by name: customers draw explicit choices from it.
+	std::vector<ComponentTypeId> plantSpecies;
+	std::unique_ptr<PlantSpecificationBuilder> specificationBuilder;
+
+	// Customers spawned today; their requests hold weak references, so the nursery keeps them alive until served.
+	std::vector<std::shared_ptr<Customer>> activeCustomers;
+	int customersPerDay;
+	uint64_t customersSpawned; // Counter for the customer random stream.
+
+	// Day tick partitioning: one work unit per owning Group (plot), rebuilt when the tree changes.
+	struct TickUnit;
+	std::vector<TickUnit> tickUnits;
+	uint64_t tickUnitsVersion;
+	uint64_t tickUnitsSeed; // seed the units' cached quiet days were solved with
+	// Per PlantStore holding tick unit plants: each slot's unit and next due day (simulateUntil()).
+	struct StoreSlots;
+	std::vector<StoreSlots> storeSlots;
+	// simulateUntil()'s queue of plants by the day they next raise an event; null outside of it.
+	struct DeferredDays;
+	std::unique_ptr<DeferredDays> deferred;
+	unsigned threadCount;
+	uint64_t seed;
+	std::unique_ptr<ThreadPool> workers; // null while running single-threaded
+	// Stage populations and transition counts from the most recent day tick.
+	LifecycleCounters lifecycleReport;
+	PhaseTimer phaseTimer; // optional; see setPhaseTimer()
+	// Shares unchanged parts of the inventory between successive createMemento() snapshots.
+	std::unique_ptr<SnapshotRecorder> snapshotRecorder;
 
 public:
 	Nursery();
@@ -52,24 +129,177 @@ public:
 
 	/**
 	 * @brief The main game loop. This method drives the entire simulation.
+	 *
+	 * Each day ticks every plant in the inventory, spawns customers and then
+	 * processes the request queue (see Phase). The plant tick is split into one work unit per
+	 * plot and, with more than one thread configured, runs on a work-stealing pool;
+	 * the result (plant state and queued commands) is bit-identical to a serial run.
+	 * @param days Number of days to simulate.
+	 */
+	void runSimulation(int days = 1);
+
+	/**
+	 * @brief Event-driven simulation: advances to 'day', ticking each plant only on its event days.
+	 *
+	 * Each plant's next event (a thirst crossing or a lifecycle stage change) is
+	 * solved in closed form from its age, health and water level
+	 * (PlantStore::quietDays()) and queued by day. Every day still spawns customers
+	 * and processes the request queue, but its tick only advances the plants due
+	 * that day (or a plot's whole unit when many of its plants are due); the
+	 * others are deferred (PlantStore::defer()) and caught up with
+	 * PlantStore::fastForward() before customers or commands run, when they
+	 * change plot, and at the end; reading a plant never writes to it. Observers
+	 * and plant event subscribers are called about plants the tick just advanced.
+	 * Days with no customer, command or due plant are skipped outright, unseen by
+	 * the phase timer. The resulting state, plant events and commands are
+	 * identical to runSimulation(); getLifecycleReport() is brought up to date on return.
+	 */
+	void simulateUntil(int day);
+
+	/**
+	 * @brief Maintenance: defragments ComponentTree::shared() if churn has fragmented it.
+	 *
+	 * Never called by the simulation itself, since it renumbers tree handles held
+	 * elsewhere (Inventory::collectNodes() results, ParallelWalk plans). Call it
+	 * between days, when none are in use.
+	 * @return Whether the tree was defragmented.
+	 */
+	bool defragmentTree();
+
+	/**
+	 * @brief Sets how many threads the plant tick may use (1 = serial, 0 = all cores).
+	 */
+	void setThreadCount(unsigned count);
+	unsigned getThreadCount() const noexcept { return threadCount; }
+
+	// Seed for the per-plot counter-based random streams (daily weather).
+	void setSeed(uint64_t value) noexcept {
+		seed = value;
+		tickUnitsVersion = std::numeric_limits<uint64_t>::max(); // new weather: re-solve quiet days
+	}
+	uint64_t getSeed() const noexcept { return seed; }
+
+	// Customers spawned per simulated day (default 1).
+	void setCustomersPerDay(int count) noexcept { customersPerDay = count < 0 ? 0 : count; }
+	int getCustomersPerDay() const noexcept { return customersPerDay; }
+
+	/**
+	 * @brief Installs a callback timing every phase of runSimulation(); pass nullptr to remove it.
+	 *
+	 * Without a timer no clocks are read.
+	 */
+	void setPhaseTimer(PhaseTimer timer) { phaseTimer = std::move(timer); }
+
+	int getCurrentDay() const noexcept { return currentDay; }
+	const std::shared_ptr<Inventory>& getInventory() const noexcept { return inventory; }
+	// Queued commands, including ones deferred to a later day and undrained submissions.
+	// Approximate while other threads are still submitting.
+	std::size_t pendingRequests() const noexcept {
+		return requestQueue.size() + requestInbox.sizeApprox() + inboxOverflowSize.load(std::memory_order_acquire);
+	}
+	// Waterings removed by coalescing since the nursery was created: within a batch of
+	// submissions, or merged into a queued command by requestQueue.
+	uint64_t getCoalescedRequestCount() const noexcept { return coalescedRequests + requestQueue.mergedCount(); }
+	// Read access to the request scheduler (queue sizes and queue-wait statistics).
+	const CommandScheduler& getRequestQueue() const noexcept { return requestQueue; }
+	// The day tick's plant events (stage changes and thirst crossings); subscribe to receive them in batches.
+	PlantEventBus& getPlantEvents() noexcept { return plantEvents; }
+
+	/**
+	 * @brief Per-stage population and per-transition counts for the last simulated day.
+	 *
+	 * Gathered by the lifecycle engine during the tick itself, so keeping it costs
+	 * no extra pass over the inventory.
+	 */
+	const LifecycleCounters& getLifecycleReport() const noexcept { return lifecycleReport; }
+
+	/**
+	 * @brief Creates an owning plot, either top-level or nested inside 'parent'.
+	 */
+	std::shared_ptr<Group> addPlot(const std::string& name, const std::shared_ptr<Group>& parent = nullptr);
+
+	/**
+	 * @brief Makes 'factory' the one stockPlant() uses for the plant type 'species'.
+	 *
+	 * 'species' is a TypeRegistry id. A null factory removes the species.
+	 */
+	void setPlantFactory(ComponentTypeId species, std::shared_ptr<PlantFactory> factory);
+
+	/**
+	 * @brief Creates a plant with the registered factory for 'species' and places it.
+	 *
+	 * The plant is added to 'plot', or to the top level of the inventory when no
+	 * plot is given, and put on the NurserySupervisor's watch list: the supervisor
+	 * reads the day tick's plant events in one batch and queues waterings for the
+	 * watched plants that are left thirsty. Plants placed in the inventory some
+	 * other way are ticked but not watered until NurserySupervisor::watch() is
+	 * called for them. The factory is found by indexing with the type id; the
+	 * overload taking a name looks the id up first.
+	 * @return The new plant, or nullptr if no factory is registered for 'species'.
 	 */
-	void runSimulation();
+	std::shared_ptr<Plant> stockPlant(ComponentTypeId species, const std::shared_ptr<Group>& plot = nullptr);
+	std::shared_ptr<Plant> stockPlant(const std::string& species, const std::shared_ptr<Group>& plot = nullptr);
+
+	/**
+	 * @brief Stocks 'count' seedlings of 'species' at once (PlantFactory::createPlants()).
+	 *
+	 * Same placement and supervision as stockPlant(), with the allocations done in bulk.
+	 * @return The new plants, or an empty vector if no factory is registered for 'species'.
+	 */
+	std::vector<std::shared_ptr<Plant>> stockPlants(ComponentTypeId species, std::size_t count,
+		const std::shared_ptr<Group>& plot = nullptr);
+	std::vector<std::shared_ptr<Plant>> stockPlants(const std::string& species, std::size_t count,
+		const std::shared_ptr<Group>& plot = nullptr);
 
 	/**
 	 * @brief Adds a command to the central request queue.
 	 * 
 	 * This is called by components like the NurserySupervisor to queue up new tasks.
+	 * It is safe to call from any thread: commands go through a lock-free MPSC ring
+	 * and are drained in batches by processRequestQueue(). Commands that observers
+	 * raise from the tick's plant events are instead collected and scheduled
+	 * together when the tick finishes, in plant id order.
 	 * @param cmd The command to be added (ownership transferred).
 	 */
 	void addRequest(std::unique_ptr<Command> cmd);
 
+	/**
+	 * @brief Queues a command to be processed 'daysAhead' days from today (0 = today).
+	 *
+	 * Deferred commands wait on the scheduler's timing wheel and join the ready
+	 * queue at the start of their day. The day counts from when the simulation
+	 * thread drains the submission; thread-safe like addRequest().
+	 */
+	void scheduleRequest(std::unique_ptr<Command> cmd, unsigned daysAhead);
+
+	/**
+	 * @brief Adds a staff member to the routing pools of every command kind it can handle.
+	 *
+	 * Its Staff::getDailyCapacity() limits how much work it is given per day.
+	 */
+	void hireStaff(const std::shared_ptr<Staff>& member);
+
+	// Per-staff utilization and per-kind performed/deferred/dropped counts.
+	const CommandRouter& getStaffRouter() const noexcept { return staffRouter; }
+
 	// --- Memento Pattern (Originator Methods) ---
 
 	/**
 	 * @brief Creates a Memento containing a snapshot of the nursery's current state.
-	 * @return A pointer to a new Memento object.
+	 *
+	 * The snapshot is the JSON document described in HEADER_GUIDE.md (Memento::serialize()):
+	 * every component in pre-order, the membership of each group, the top-level ids and
+	 * the scheduled commands (submissions not yet drained from the inbox are not included).
+	 * The inventory is held as an InventorySnapshot that shares every subtree unchanged
+	 * since the previous call, so time and memory scale with what changed in between.
+	 * PlantStore::tickRange() and fastForward() mark the whole tree changed
+	 * (ComponentTree::markAllChanged()), so the first capture after any day tick
+	 * serializes every component again; only captures between ticks skip unchanged
+	 * subtrees (re-checked records that come out the same still share memory).
+	 * Not const: it advances the snapshot recorder and the tree's change epoch.
+	 * @return A pointer to a new Memento object (caller owns it).
 	 */
-	Memento* createMemento() const;
+	Memento* createMemento();
 
 	/**
 	 * @brief Restores the nursery's state from a given Memento.
@@ -84,18 +314,118 @@ private:
 	 * @brief Contains the logic for dynamically spawning a new customer.
 	 * 
 	 * This method uses the Builder pattern to construct a new customer request
-	 * based on the current state of the inventory.
+	 * and queues it as a FulfillCustomerCommand. The request is drawn from a
+	 * counter-based random stream, so the same seed yields the same customers.
 	 */
 	void spawnCustomer();
 
 	/**
 	 * @brief Processes all commands currently in the request queue.
 	 * 
-	 * This method dequeues commands and passes them to the head of the
-	 * Staff's Chain of Responsibility.
+	 * This method dequeues the commands that are ready today, most urgent first,
+	 * and routes each one to a capable staff member through staffRouter. Commands
+	 * every capable member is too busy for today are requeued for tomorrow.
 	 */
 	void processRequestQueue();
 
+	// Moves every published command from the inbox into requestQueue, then the overflow list
+	// if the ring is empty (a producer may still be writing a cell it claimed).
+	void drainRequestInbox();
+
+	/**
+	 * @brief Coalesces the same-day WaterPlantCommands in a batch of submissions.
+	 *
+	 * Waterings of a plant that is already targeted earlier in the batch are
+	 * dropped, and the rest are merged per owning Group into one BatchWaterCommand
+	 * placed where the plot's first watering was. Other commands keep their order.
+	 * requestQueue then merges each batch into the plot's already queued watering,
+	 * if any; a plot's lone watering is made a batch when there is one to join.
+	 */
+	void coalesceWaterings(std::vector<PendingRequest>& requests);
+
+	/**
+	 * @brief Advances every inventory plant by one day (serially or on the pool).
+	 *
+	 * Then, on the calling thread, calls the observers attached to changed plants
+	 * and publishes the plant events.
+	 */
+	void tickPlants();
+
+	// Advances one day: tick (tickPlants() or, within simulateUntil(), tickDuePlants()), customers, requests.
+	void runDay();
+
+	// --- simulateUntil(): plants are deferred and ticked on their event days only ---
+
+	// Catches every deferred plant up to today, then defers them all again over a window of
+	// days towards 'day' and queues their event days in it.
+	void openDeferWindow(int day);
+
+	// Queues the next event day of a deferred slot of storeSlots[storeIndex], if it falls in the window.
+	void scheduleDue(std::size_t storeIndex, uint32_t slot);
+
+	// Queues again the deferred slots that were written to (PlantStore::takeRescheduled()).
+	void scheduleRescheduled();
+
+	// Moves today forward over days on which only plant decay would happen, up to 'day' or the
+	// end of the window. Returns whether it moved.
+	bool skipQuietDays(int day);
+
+	/**
+	 * @brief simulateUntil()'s day tick: advances only the plants whose event day is today.
+	 *
+	 * They are caught up to yesterday and ticked in tick unit order, as runs of
+	 * consecutive slots, then get their next event day queued; observers and plant
+	 * events follow as in tickPlants(). A unit with a large share of its plants
+	 * due is ticked whole (runTickUnit()) instead: its other plants are quiet
+	 * through today, so they only move ahead of their catch-up.
+	 */
+	void tickDuePlants();
+
+	// Catches every deferred plant up to today and ends deferral (end of simulateUntil()).
+	void endDeferral();
+
+	// Brings every deferred plant up to today, one tick unit at a time (serially or on the pool).
+	void catchUpDeferred();
+
+	// Whether commands are ready or submissions wait in the inbox.
+	bool requestsWaiting() const noexcept;
+
+	// Index of 'store' in storeSlots, adding it when new.
+	std::size_t storeIndexOf(PlantStore* store);
+
+	// Fills unit.weatherPrefix with the unit's summed weather loss over 'days' days after 'fromDay'.
+	void computeWeatherPrefix(TickUnit& unit, uint32_t fromDay, uint32_t days) const;
+
+	// Extra water the plot behind 'streamId' loses on 'day': value 'day' of the plot's own stream.
+	int32_t weatherLoss(uint64_t streamId, uint64_t day) const noexcept;
+
+	/**
+	 * @brief Rebuilds tickUnits from the inventory tree in pre-order.
+	 *
+	 * Plants that changed weather stream, or joined, drop their cached quiet
+	 * days; within simulateUntil() they are caught up first, and the plants that
+	 * left every unit are caught up and no longer deferred.
+	 */
+	void rebuildTickUnits();
+
+	// Ticks one unit's plants, refreshes views of the changed ones, records their events and
+	// notes the ones with attached observers (called by tickPlants() after every unit is done).
+	void runTickUnit(TickUnit& unit);
+
+	// Hands each plot the state its unit's last tick or skip left its plants in
+	// (Group::assignPlantState()); runs before any observer can change a plant.
+	void assignPlotStates();
+
+	// Delivers the recorded plant events and schedules the commands the observers raise.
+	void publishPlantEvents();
+
+	// Runs fn(), reporting its duration to the phase timer if one is installed.
+	template <typename Fn>
+	void timePhase(Phase phase, Fn&& fn);
+
+	// Lazily creates the supervisor (needs shared_from_this()) and subscribes it to plantEvents.
+	const std::shared_ptr<NurserySupervisor>& getSupervisor();
+
 	/**
 	 * @brief Initializes the nursery's starting state.
 	 * 
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "ThreadPool.h"
+#include "../Components/ComponentTree.h"
+
+class Inventory;
+class InventoryComponent;
+
+/**
+ * @class ParallelWalk
+ * @brief Runs bulk operations over owned subtrees on a ThreadPool, balanced by subtree size.
+ *
+ * Construction cuts the pre-order sequence of the owned tree (ComponentTree
+ * edges; view members are not followed, so every component is visited once)
+ * into chunks of roughly equal size. Sizes come from the owning Groups' cached
+ * plant counts, so planning only descends into subtrees too large for one
+ * chunk: a plot holding half the nursery is split across many chunks while
+ * runs of small plots share one.
+ *
+ * The chunk size depends on the tree alone, not on the thread count, and
+ * transformReduce() combines the per-chunk partials in chunk order, so a
+ * reduction gives the same result serially and on any number of threads, even
+ * for non-associative operations such as floating-point sums.
+ *
+ * fn/transform run concurrently on distinct components: they may change the
+ * component they are given (including its plant state) but not the tree. The
+ * plan is only valid while the tree is unchanged; walking a plan made before a
+ * ComponentTree::defragment() throws std::logic_error instead of following
+ * renumbered handles.
+ */
+class ParallelWalk {
+public:
+	// Plans a walk over every top-level component of 'inventory' and its owned subtree.
+	explicit ParallelWalk(const Inventory& inventory);
+	// Plans a walk over 'root' and its owned subtree.
+	explicit ParallelWalk(const InventoryComponent& root);
+
+	std::size_t chunkCount() const noexcept { return chunks.size(); }
+	// Whether the tree has been defragmented since planning (plan again before walking).
+	bool stale() const noexcept { return generation != ComponentTree::shared().layoutGeneration(); }
+
+	// Calls fn(InventoryComponent&) once per component; 'pool' may be null to run serially.
+	template <typename Fn>
+	void forEach(ThreadPool* pool, Fn&& fn) const {
+		run(pool, [&](std::size_t chunk) { visitChunk(chunk, fn); });
+	}
+
+	// Folds reduce(acc, transform(component)) over each chunk from 'identity', then
+	// folds the partials in chunk order; 'pool' may be null to run serially.
+	template <typename T, typename Reduce, typename Transform>
+	T transformReduce(ThreadPool* pool, T identity, Reduce reduce, Transform transform) const {
+		std::vector<T> partials(chunks.size(), identity);
+		run(pool, [&](std::size_t chunk) {
+			T partial = identity;
+			visitChunk(chunk, [&](InventoryComponent& component) { partial = reduce(std::move(partial), transform(component)); });
+			partials[chunk] = std::move(partial);
+		});
+		T result = std::move(identity);
+		for (auto& partial : partials) result = reduce(std::move(result), std::move(partial));
+		return result;
+	}
+
+private:
+	// One piece of a chunk: the whole subtrees of 'node' and its next siblings, 'subtrees'
+	// of them, or (subtrees == 0) 'node' alone, its children being planned separately.
+	struct Entry {
+		ComponentTree::Handle node;
+		std::size_t subtrees;
+	};
+
+	void plan(const std::vector<ComponentTree::Handle>& roots);
+
+	template <typename Task>
+	void run(ThreadPool* pool, Task&& task) const {
+		if (stale()) throw std::logic_error("ParallelWalk: tree defragmented since the walk was planned");
+		if (pool && chunks.size() > 1) {
+			pool->parallelFor(chunks.size(), task);
+			return;
+		}
+		for (std::size_t chunk = 0; chunk < chunks.size(); ++chunk) task(chunk);
+	}
+
+	template <typename Fn>
+	void visitChunk(std::size_t chunk, Fn&& fn) const {
+		const ComponentTree& tree = ComponentTree::shared();
+		for (const Entry& entry : chunks[chunk]) {
+			if (entry.subtrees == 0) {
+				fn(*tree.component(entry.node));
+				continue;
+			}
+			ComponentTree::Handle root = entry.node;
+			for (std::size_t subtree = 0; subtree < entry.subtrees; ++subtree, root = tree.nextSibling(root)) {
+				tree.forEachPreOrder(root, [&](ComponentTree::Handle node) { fn(*tree.component(node)); });
+			}
+		}
+	}
+
+	std::vector<std::vector<Entry>> chunks;
+	uint64_t generation; // ComponentTree::layoutGeneration() at planning
+};
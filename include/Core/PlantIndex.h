@@ -0,0 +1,73 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "Symbol.h"
+#include "../Patterns/Builder/PlantSpecification.h"
+
+class Inventory;
+class InventoryComponent;
+class Plant;
+
+/**
+ * @class PlantIndex
+ * @brief Secondary index over the plants of an Inventory, keyed by the attributes customers ask for.
+ *
+ * Plants are bucketed by water requirement, sun requirement and name (the
+ * species a customer names explicitly); each bucket maps a plant's stocking
+ * sequence (Plant::getStockSequence()) to its id. A query visits at most nine
+ * (water, sun) cells and, per cell, the front of one name bucket (or of each
+ * name when none is given), so finding a match costs O(log n) instead of a walk
+ * over the whole inventory. Among matches the longest-stocked plant (lowest
+ * sequence) wins. Ids are no guide to that: each thread takes ids in blocks.
+ *
+ * Inventory::add() and every Group::add() below the inventory index the plants
+ * they place, and plants leaving the inventory are dropped (removeSubtree()), so
+ * the index stays the size of the stock. Plants that die or are destroyed in
+ * place are handled lazily: a query resolves each front candidate through
+ * ComponentRegistry and drops it if it is gone, no longer in the inventory or
+ * Withered (a terminal stage, see LifecycleRules). A plant placed again is
+ * indexed again under the sequence it already has.
+ *
+ * Plants reachable only through view Groups are not indexed.
+ */
+class PlantIndex {
+public:
+	// Indexes every plant in the owned subtree of 'root'.
+	void addSubtree(const InventoryComponent& root);
+	// Drops every plant in the owned subtree of 'root', which is leaving the inventory.
+	void removeSubtree(const InventoryComponent& root);
+
+	// The longest-stocked living plant of 'within' needing at most 'maxWater' and 'maxSun'
+	// and, when 'name' is not empty, carrying that name; nullptr if none.
+	std::shared_ptr<Plant> findAvailable(const Inventory& within, WaterLevel maxWater, SunLevel maxSun,
+		const std::string& name);
+
+	// Number of index entries, including ones not yet found stale.
+	std::size_t size() const noexcept { return entries; }
+
+private:
+	// Stocking sequence -> plant id.
+	using Bucket = std::map<uint64_t, uint64_t>;
+
+	// Plants with one (water, sun) requirement pair, by interned name.
+	struct Cell {
+		std::unordered_map<Symbol, Bucket, Symbol::Hash> byName;
+	};
+
+	static constexpr std::size_t kWaterLevels = 3;
+	static constexpr std::size_t kSunLevels = 3;
+
+	void add(Plant& plant);
+	void remove(const Plant& plant);
+	Bucket& bucketOf(const Plant& plant);
+	// Drops stale candidates from the front of 'bucket' and returns the first live one.
+	std::shared_ptr<Plant> front(const Inventory& within, Bucket& bucket, WaterLevel water, SunLevel sun);
+
+	std::array<Cell, kWaterLevels * kSunLevels> cells;
+	std::size_t entries{0};
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @class SlabPool
+ * @brief Fixed-size block allocator carving blocks out of large slabs.
+ *
+ * The first allocation fixes the block size (for allocate_shared, the size of
+ * the control block holding the object). Later blocks of that size come from
+ * the free list of released blocks, else from the current slab, else from a
+ * new slab of slabBlocks() blocks; requests of any other size fall back to
+ * operator new (and must not be over-aligned). Slabs are only returned to the
+ * system when the pool is destroyed, so a pool must outlive every block it
+ * handed out; the species pools used by the plant factories are never destroyed.
+ *
+ * Allocation and release are serialized internally.
+ */
+class SlabPool {
+public:
+	struct Stats {
+		uint64_t allocations{0}; // Every allocate() call.
+		uint64_t reused{0};      // Served from the free list.
+		uint64_t carved{0};      // Served from fresh slab space.
+		uint64_t fallbacks{0};   // Other sizes, served by operator new.
+		uint64_t slabs{0};       // Slabs obtained from the system.
+		std::size_t blockSize{0};
+		std::size_t bytesReserved{0}; // Total slab bytes.
+		std::size_t liveBlocks{0};
+	};
+
+	explicit SlabPool(std::size_t slabBlocks = 1024);
+	~SlabPool();
+	SlabPool(const SlabPool&) = delete;
+	SlabPool& operator=(const SlabPool&) = delete;
+
+	void* allocate(std::size_t bytes, std::size_t alignment);
+	void deallocate(void* block, std::size_t bytes) noexcept;
+
+	// Makes room for 'count' more blocks with at most one new slab. A no-op until the
+	// first allocation has fixed the block size.
+	void reserve(std::size_t count);
+
+	Stats stats() const;
+	std::size_t slabBlocks() const noexcept { return blocksPerSlab; }
+
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	// Threads the unused rest of the current slab onto the free list, then starts a slab of 'blocks'.
+	void newSlab(std::size_t blocks);
+
+	mutable std::mutex mutex;
+	const std::size_t blocksPerSlab;
+	std::size_t blockSize{0};
+	std::size_t blockAlignment{alignof(std::max_align_t)};
+	FreeBlock* freeList{nullptr};
+	std::size_t freeCount{0};
+	unsigned char* cursor{nullptr};
+	unsigned char* slabEnd{nullptr};
+	std::vector<unsigned char*> slabs;
+	Stats counters;
+};
+
+/**
+ * @class PoolAllocator
+ * @brief Standard allocator over a SlabPool, for std::allocate_shared.
+ *
+ * Holds a plain pointer: the pool must outlive every object (and control block)
+ * allocated through it.
+ */
+template <typename T>
+class PoolAllocator {
+public:
+	using value_type = T;
+
+	explicit PoolAllocator(SlabPool& pool) noexcept : pool(&pool) {}
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+	T* allocate(std::size_t count) { return static_cast<T*>(pool->allocate(count * sizeof(T), alignof(T))); }
+	void deallocate(T* block, std::size_t count) noexcept { pool->deallocate(block, count * sizeof(T)); }
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U>& other) const noexcept { return pool == other.pool; }
+	template <typename U>
+	bool operator!=(const PoolAllocator<U>& other) const noexcept { return pool != other.pool; }
+
+private:
+	template <typename U>
+	friend class PoolAllocator;
+	SlabPool* pool;
+};
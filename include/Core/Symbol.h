@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+/**
+ * @class Symbol
+ * @brief An interned string: one shared, immutable buffer per distinct text.
+ *
+ * Constructing a Symbol looks its text up in a process-wide table (adding it
+ * the first time), so every "Rose" shares one buffer and two Symbols are equal
+ * exactly when they point at the same entry: comparing and hashing them is a
+ * pointer compare. Entries are never freed, so a view() stays valid for the
+ * life of the process; intern bounded vocabularies (species, type names), not
+ * free-form text or names composed from them. Interning is thread-safe; copying and
+ * reading a Symbol take no lock.
+ *
+ * The converting constructors are implicit so that names can be passed as
+ * literals or strings wherever a Symbol is expected.
+ */
+class Symbol {
+public:
+	// The empty string.
+	constexpr Symbol() noexcept = default;
+	Symbol(std::string_view text);
+	Symbol(const std::string& text) : Symbol(std::string_view(text)) {}
+	Symbol(const char* text) : Symbol(std::string_view(text)) {}
+
+	// Finds the symbol for 'text' without interning it; false if it was never interned.
+	static bool lookup(std::string_view text, Symbol& symbol);
+	// Number of distinct non-empty texts interned so far.
+	static std::size_t internedCount();
+
+	std::string_view view() const noexcept { return text ? std::string_view(*text) : std::string_view(); }
+	std::string str() const { return std::string(view()); }
+	bool empty() const noexcept { return text == nullptr; }
+
+	friend bool operator==(Symbol a, Symbol b) noexcept { return a.text == b.text; }
+	friend bool operator!=(Symbol a, Symbol b) noexcept { return a.text != b.text; }
+	// Orders by table entry, not alphabetically; stable within a run only.
+	friend bool operator<(Symbol a, Symbol b) noexcept { return std::less<const std::string*>()(a.text, b.text); }
+
+	struct Hash {
+		std::size_t operator()(Symbol symbol) const noexcept { return std::hash<const std::string*>()(symbol.text); }
+	};
+
+private:
+	// Null for the empty string.
+	const std::string* text{nullptr};
+};
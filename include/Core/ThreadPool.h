@@ -0,0 +1,68 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief A small work-stealing pool used for the parallel phases of the simulation.
+ *
+ * parallelFor() deals the task indices round-robin into one deque per participant
+ * (the worker threads plus the calling thread). Each participant drains its own
+ * deque from the front and, once it runs dry, steals from the back of the others,
+ * so a few oversized work units (large plots) do not leave the rest of the pool idle.
+ *
+ * The pool only schedules work; callers that need deterministic output must make
+ * each task write to its own slot and merge the slots in index order afterwards.
+ */
+class ThreadPool {
+public:
+	// threadCount includes the calling thread; 0 selects std::thread::hardware_concurrency().
+	explicit ThreadPool(unsigned threadCount = 0);
+	~ThreadPool();
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Total participants in parallelFor(), including the caller.
+	unsigned size() const noexcept { return static_cast<unsigned>(queues.size()); }
+
+	/**
+	 * @brief Runs task(i) for every i in [0, count) and returns when all have finished.
+	 *
+	 * The first exception thrown by a task is rethrown here after the batch drains.
+	 * Not reentrant: tasks must not call parallelFor() on the same pool.
+	 */
+	void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+	struct WorkQueue {
+		std::mutex mutex;
+		std::deque<std::size_t> items;
+	};
+
+	// Pops from the participant's own queue, or steals from another one.
+	bool takeWork(unsigned participant, std::size_t& index);
+	void runBatch(unsigned participant);
+	void workerLoop(unsigned participant);
+
+	std::vector<std::unique_ptr<WorkQueue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex batchMutex;
+	std::condition_variable batchReady;
+	std::condition_variable batchDone;
+	const std::function<void(std::size_t)>* currentTask{nullptr};
+	uint64_t generation{0};
+	unsigned activeWorkers{0};
+	bool stopping{false};
+
+	std::mutex errorMutex;
+	std::exception_ptr firstError;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include "Command.h"
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class Group;
+class Plant;
+class Rose;
+class Cactus;
+
+/**
+ * @class BatchWaterCommand
+ * @brief Waters many plants of one plot as a single command.
+ *
+ * Produced by the Nursery when it coalesces WaterPlantCommands that target plants
+ * of the same Group: one queue entry and one trip down the staff chain replace
+ * one per plant. The targets are bucketed by species when the batch is built, so
+ * execute() runs one non-virtual loop per species (Rose::waterAll, then
+ * Cactus::waterAll) and only falls back to virtual Plant::water() for others.
+ *
+ * Like WaterPlantCommand it holds weak references; plants that are gone by the
+ * time it runs are skipped. targetId is the plot's id (0 for top-level plants).
+ *
+ * While queued it absorbs later waterings of the same plot (same mergeKey() as
+ * a WaterPlantCommand of that plot), skipping plants it already targets.
+ */
+class BatchWaterCommand : public Command {
+private:
+	std::weak_ptr<Group> plot;
+	std::vector<std::weak_ptr<Rose>> roses;
+	std::vector<std::weak_ptr<Cactus>> cacti;
+	std::vector<std::weak_ptr<Plant>> others;
+	uint64_t targetId;
+	uint64_t plotMergeKey;           // WaterPlantCommand::plotKey() of the plot it was built for
+	std::vector<uint64_t> memberIds; // ids of every targeted plant, sorted
+	Status status;
+
+	// Adds the plants of 'plants' not yet targeted.
+	void addPlants(const std::vector<std::shared_ptr<Plant>>& plants);
+
+public:
+	BatchWaterCommand(const std::shared_ptr<Group>& plot, const std::vector<std::shared_ptr<Plant>>& plants);
+	~BatchWaterCommand() override = default;
+
+	void execute() override;
+	const char* typeName() const noexcept override;
+	Kind kind() const noexcept override { return Kind::BatchWater; }
+	// One unit per targeted plant.
+	std::size_t workUnits() const noexcept override { return size(); }
+	// The most urgent member decides: a batch is never queued behind one of its own plants.
+	int urgency() const override;
+
+	// Number of plants the batch targets.
+	std::size_t size() const noexcept { return roses.size() + cacti.size() + others.size(); }
+
+	uint64_t mergeKey() const override { return plotMergeKey; }
+	// Absorbs a WaterPlantCommand with a live target or another BatchWaterCommand.
+	bool absorb(Command& later) override;
+
+	std::string serialize() const override;
+	void deserialize(const std::string& data) override;
+	Status getStatus() const override;
+	void setStatus(Status s) override;
+	uint64_t getTargetId() const override;
+	void setTargetId(uint64_t id) override;
+};
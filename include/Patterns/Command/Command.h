@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -15,9 +16,33 @@ class Command {
 public:
 	virtual ~Command() = default;
 	enum class Status { Pending, Completed, Failed, Cancelled };
+	// Concrete command type, used as the key of CommandRouter's routing table.
+	enum class Kind : uint8_t { WaterPlant, BatchWater, FulfillCustomer };
+	static constexpr std::size_t kKindCount = 3;
 
 	virtual void execute() = 0;
 
+	// Stable type name (a string literal); used for serialization and per-type statistics.
+	virtual const char* typeName() const noexcept = 0;
+
+	virtual Kind kind() const noexcept = 0;
+
+	// Scheduling priority sampled when the command is queued; higher runs first.
+	virtual int urgency() const { return 0; }
+
+	// Work the command costs the staff member who performs it, against their daily capacity.
+	virtual std::size_t workUnits() const noexcept { return 1; }
+
+	// Commands sharing a non-zero key do work that can be folded into one queue entry
+	// (see CommandScheduler::schedule()); 0 means the command is never merged.
+	virtual uint64_t mergeKey() const { return 0; }
+	// Takes over the work of 'later', a command with the same mergeKey(). Returns false if
+	// this command cannot cover it; on true the caller discards 'later'.
+	virtual bool absorb(Command& later) {
+		(void)later;
+		return false;
+	}
+
 	// Query and set status
 	virtual Status getStatus() const = 0;
 	virtual void setStatus(Status s) = 0;
@@ -29,5 +54,26 @@ public:
 	// Serialization hooks for SaveSystem (JSON string)
 	virtual std::string serialize() const = 0;
 	virtual void deserialize(const std::string& data) = 0;
+
+	// Name used for a Kind in reports.
+	static const char* kindName(Kind k) noexcept {
+		switch (k) {
+		case Kind::WaterPlant: return "WaterPlant";
+		case Kind::BatchWater: return "BatchWater";
+		case Kind::FulfillCustomer: return "FulfillCustomer";
+		}
+		return "Unknown";
+	}
+
+	// Name used for a Status in serialized output.
+	static const char* statusName(Status s) noexcept {
+		switch (s) {
+		case Status::Pending: return "Pending";
+		case Status::Completed: return "Completed";
+		case Status::Failed: return "Failed";
+		case Status::Cancelled: return "Cancelled";
+		}
+		return "Pending";
+	}
 };
 
@@ -4,9 +4,10 @@
 #include <memory>
 
 // Forward declarations
-class PlantSpecification;
+struct PlantSpecification;
 class Inventory;
 class Customer;
+class Plant;
 
 /**
  * @class FulfillCustomerCommand
@@ -15,12 +16,22 @@ class Customer;
  * This command holds the PlantSpecification, and non-owning references to the Inventory
  * and Customer so it can locate and allocate the requested plant(s). Non-owning references
  * are stored as weak_ptrs and will be checked at execution time.
+ *
+ * A plant matches when it is still alive, needs no more water or sun than the
+ * specification offers and, if one is given, carries the explicit name. A
+ * PURCHASE removes the longest-stocked match (lowest stocking sequence, found
+ * through the Inventory's PlantIndex) from the inventory, wraps it in the requested
+ * decorators and hands it to the customer; a RECOMMENDATION only
+ * records the match as the target. No match fails the command, and a customer
+ * who has already left cancels it.
  */
 class FulfillCustomerCommand : public Command {
 private:
 	std::unique_ptr<PlantSpecification> spec; 
 	std::weak_ptr<Inventory> inventory;
 	std::weak_ptr<Customer> customer;
+	uint64_t targetId;
+	Status status;
 
 public:
 	FulfillCustomerCommand(std::unique_ptr<PlantSpecification> spec,
@@ -29,6 +40,8 @@ public:
 	~FulfillCustomerCommand() override = default;
 
 	void execute() override;
+	const char* typeName() const noexcept override;
+	Kind kind() const noexcept override { return Kind::FulfillCustomer; }
 
 	std::string serialize() const override;
 	void deserialize(const std::string& data) override;
@@ -3,7 +3,8 @@
 #include "Command.h"
 #include <memory>
 
-// Forward declaration
+// Forward declarations
+class Group;
 class Plant;
 
 /**
@@ -17,18 +18,38 @@ class Plant;
 class WaterPlantCommand : public Command {
 private:
 	std::weak_ptr<Plant> targetPlant; // Non-owning reference; may be expired.
+	uint64_t targetId;
+	Status status;
 
 public:
 	WaterPlantCommand(const std::shared_ptr<Plant>& plant);
 	~WaterPlantCommand() override = default;
 
 	void execute() override;
+	const char* typeName() const noexcept override;
+	Kind kind() const noexcept override { return Kind::WaterPlant; }
+	// Sicker and drier plants are watered first.
+	int urgency() const override;
+	// Urgency of watering 'plant' (shared with BatchWaterCommand).
+	static int urgencyOf(const Plant& plant);
+
+	// The plant to water, or nullptr if it no longer exists.
+	std::shared_ptr<Plant> getTarget() const { return targetPlant.lock(); }
+
+	// Waterings merge per plot: the key of the target's current plot (see plotKey()), or
+	// one of the target's own for a top-level plant.
+	uint64_t mergeKey() const override;
+	// Absorbs only a duplicate: a WaterPlantCommand for the same plant.
+	bool absorb(Command& later) override;
+	// Merge key shared by the waterings of 'plot' (nullptr: top-level plants).
+	static uint64_t plotKey(const Group* plot) noexcept;
 
 	std::string serialize() const override;
 	void deserialize(const std::string& data) override;
 	Status getStatus() const override;
 	void setStatus(Status s) override;
 	uint64_t getTargetId() const override;
+	// Also rebinds the target to the live plant with this id (see Plant::resolve()).
 	void setTargetId(uint64_t id) override;
 };
 
@@ -0,0 +1,53 @@
+#pragma once
+#include "PlantDecorator.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+/**
+ * @class DecoratedItem
+ * @brief One wrapper carrying every add-on of a decorated item.
+ *
+ * Equivalent to a chain of PotDecorator/RibbonDecorator/GiftWrapDecorator
+ * around the same component, innermost add-on first, but a single heap object:
+ * the add-ons are an inline list, and the price and composed name
+ * are updated when an add-on is attached, so getPrice() and nameView() neither
+ * recurse nor build strings. Prices add in the same order as the chain, so both
+ * give the same double.
+ *
+ * The wrapped component's price and name are read at construction; wrap plants
+ * (or decorated plants), whose price and name are fixed.
+ */
+class DecoratedItem final : public PlantDecorator {
+public:
+    enum class AddOn : uint8_t { Pot, Ribbon, GiftWrap };
+    static constexpr std::size_t kMaxAddOns = 7;
+
+    explicit DecoratedItem(const std::shared_ptr<InventoryComponent>& component, std::initializer_list<AddOn> addOns = {});
+    ~DecoratedItem() override = default;
+
+    // Attaches 'addOn' outside the existing ones; throws std::length_error past kMaxAddOns.
+    void addOn(AddOn addOn);
+    std::size_t addOnCount() const noexcept { return count; }
+    AddOn addOnAt(std::size_t index) const noexcept { return addOns[index]; }
+
+    double getPrice() const override { return price; }
+    std::shared_ptr<InventoryComponent> clone() const override;
+    std::shared_ptr<InventoryComponent> blueprintClone() const override;
+    std::string serialize() const override;
+    void deserialize(const std::string& data) override;
+    std::string_view typeNameView() const override;
+
+    // PlantSpecification decorator names: "Pot", "Ribbon" and "GiftWrap".
+    static const char* addOnName(AddOn addOn) noexcept;
+    // Sets 'addOn' and returns true when 'text' is one of those names.
+    static bool parseAddOn(const std::string& text, AddOn& addOn) noexcept;
+
+private:
+    std::array<AddOn, kMaxAddOns> addOns{};
+    uint8_t count{0};
+    double price{0.0};
+};
@@ -2,16 +2,20 @@
 #include "PlantDecorator.h"
 #include <memory>
 
-class GiftWrapDecorator : public PlantDecorator {
+class GiftWrapDecorator final : public PlantDecorator {
 public:
+    // Added on top of the wrapped item's price.
+    static constexpr double kSurcharge = 3.0;
+    // Appended to the wrapped item's name.
+    static constexpr const char* kSuffix = " (gift wrapped)";
+
     GiftWrapDecorator(const std::shared_ptr<InventoryComponent>& component);
     ~GiftWrapDecorator() override = default;
 
-    // Overrides to add the gift wrap's price and modify the name.
-    std::string getName() const override;
+    // Overrides to add the gift wrap's price (the name gets kSuffix at construction).
     double getPrice() const override;
     std::shared_ptr<InventoryComponent> blueprintClone() const override;
     std::string serialize() const override;
     void deserialize(const std::string& data) override;
-    std::string typeName() const override;
+    std::string_view typeNameView() const override;
 };
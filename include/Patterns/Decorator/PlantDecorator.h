@@ -2,6 +2,8 @@
 #pragma once
 #include "../../Components/InventoryComponent.h"
 #include <memory>
+#include <string>
+#include <string_view>
 
 /**
  * @class PlantDecorator
@@ -15,6 +17,12 @@
 class PlantDecorator : public InventoryComponent {
 protected:
     std::shared_ptr<InventoryComponent> wrappedComponent; // The component being decorated.
+    // Full name: the wrapped item's (an interned Symbol for plants) plus every suffix so far.
+    // Kept per decorator rather than interned, since each add-on combination would add a symbol for good.
+    std::string name;
+
+    // Appends 'suffix' to the name; concrete decorators call it from their constructors.
+    void appendToName(std::string_view suffix);
 
 public:
     PlantDecorator(const std::shared_ptr<InventoryComponent>& component);
@@ -22,12 +30,15 @@ public:
 
     // The decorator delegates the core functionality calls to the wrapped component.
     // Concrete decorators will override these methods to add their own behavior.
-    std::string getName() const override;
+    std::string_view nameView() const override { return name; }
     double getPrice() const override;
     std::unique_ptr<Iterator> createIterator() override;
     std::shared_ptr<InventoryComponent> clone() const override;
     std::shared_ptr<InventoryComponent> blueprintClone() const override;
     std::string serialize() const override;
     void deserialize(const std::string& data) override;
-    std::string typeName() const override;
+    std::string_view typeNameView() const override;
+
+    // The component this decorator wraps (may itself be a decorator).
+    const std::shared_ptr<InventoryComponent>& getWrappedComponent() const noexcept { return wrappedComponent; }
 };
@@ -2,16 +2,20 @@
 #include "PlantDecorator.h"
 #include <memory>
 
-class PotDecorator : public PlantDecorator {
+class PotDecorator final : public PlantDecorator {
 public:
+    // Added on top of the wrapped item's price.
+    static constexpr double kSurcharge = 5.0;
+    // Appended to the wrapped item's name.
+    static constexpr const char* kSuffix = " in a pot";
+
     PotDecorator(const std::shared_ptr<InventoryComponent>& component);
     ~PotDecorator() override = default;
 
-    // Overrides to add the pot's price and modify the name.
-    std::string getName() const override;
+    // Overrides to add the pot's price (the name gets kSuffix at construction).
     double getPrice() const override;
     std::shared_ptr<InventoryComponent> blueprintClone() const override;
     std::string serialize() const override;
     void deserialize(const std::string& data) override;
-    std::string typeName() const override;
+    std::string_view typeNameView() const override;
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "PlantFactory.h"
+#include "../../Core/SlabPool.h"
 #include <memory>
 
 /**
@@ -7,9 +8,19 @@
  * @brief A concrete factory that produces Cactus objects.
  */
 class CactusFactory : public PlantFactory {
+private:
+    // Store the created plants live in; null selects PlantStore::shared().
+    std::shared_ptr<PlantStore> store;
+
 public:
-    CactusFactory();
+    CactusFactory(std::shared_ptr<PlantStore> store = nullptr);
     ~CactusFactory() override = default;
     
     std::shared_ptr<Plant> createPlant() override;
+    // One slab and one store reservation up front, then 'count' pooled plants.
+    std::vector<std::shared_ptr<Plant>> createPlants(std::size_t count) override;
+
+    // Slab pool shared by every CactusFactory: Cacti and their control blocks live in it,
+    // and destroyed ones return to its free list for reuse.
+    static SlabPool& pool();
 };
@@ -1,8 +1,12 @@
 #pragma once
+#include <cstddef>
 #include <memory>
+#include <vector>
 
-// Forward declaration
+// Forward declarations
 class Plant;
+class PlantStore;
+class SlabPool;
 
 /**
  * @interface PlantFactory
@@ -17,4 +21,17 @@ class PlantFactory {
 public:
     virtual ~PlantFactory() = default;
     virtual std::shared_ptr<Plant> createPlant() = 0;
+
+    // Creates 'count' plants at once; factories override it to allocate in bulk.
+    virtual std::vector<std::shared_ptr<Plant>> createPlants(std::size_t count) {
+        std::vector<std::shared_ptr<Plant>> plants;
+        plants.reserve(count);
+        while (plants.size() < count) plants.push_back(createPlant());
+        return plants;
+    }
+
+protected:
+    // createPlants() for factories whose createPlant() allocates from 'pool' into 'store':
+    // one store reservation and one slab up front, then 'count' plants.
+    std::vector<std::shared_ptr<Plant>> createPooled(std::size_t count, PlantStore& store, SlabPool& pool);
 };
@@ -1,6 +1,7 @@
 
 #pragma once
 #include "PlantFactory.h"
+#include "../../Core/SlabPool.h"
 #include <memory>
 
 /**
@@ -8,10 +9,20 @@
  * @brief A concrete factory that produces Rose objects.
  */
 class RoseFactory : public PlantFactory {
+private:
+    // Store the created plants live in; null selects PlantStore::shared().
+    std::shared_ptr<PlantStore> store;
+
 public:
-    RoseFactory();
+    RoseFactory(std::shared_ptr<PlantStore> store = nullptr);
     ~RoseFactory() override = default;
     
     std::shared_ptr<Plant> createPlant() override;
+    // One slab and one store reservation up front, then 'count' pooled plants.
+    std::vector<std::shared_ptr<Plant>> createPlants(std::size_t count) override;
+
+    // Slab pool shared by every RoseFactory: Roses and their control blocks live in it,
+    // and destroyed ones return to its free list for reuse.
+    static SlabPool& pool();
 };
 
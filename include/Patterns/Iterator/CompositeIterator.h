@@ -27,6 +27,9 @@ private:
 public:
     // root is a shared_ptr to the root component to traverse; strategy is owned by the iterator
     CompositeIterator(const std::shared_ptr<InventoryComponent>& root, std::unique_ptr<TraversalStrategy> traversalStrategy);
+    // Traverses each root in turn (used for the Inventory's top-level components).
+    CompositeIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots,
+                      std::unique_ptr<TraversalStrategy> traversalStrategy);
     ~CompositeIterator();
 
     std::shared_ptr<InventoryComponent> next() override;
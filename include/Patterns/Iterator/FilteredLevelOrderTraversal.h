@@ -0,0 +1,29 @@
+#pragma once
+#include "TraversalStrategy.h"
+#include "TraversalFilter.h"
+#include <memory>
+
+// Forward declaration
+class InventoryComponent;
+
+/**
+ * @class FilteredLevelOrderTraversal
+ * @brief A TraversalStrategy that visits nodes level by level (breadth-first), yielding only
+ * the components a TraversalFilter matches.
+ *
+ * Produces the matching subsequence of LevelOrderTraversal's order, except that
+ * subtrees the filter's bound rules out are never entered.
+ */
+class FilteredLevelOrderTraversal : public TraversalStrategy {
+public:
+	explicit FilteredLevelOrderTraversal(TraversalFilter filter);
+	~FilteredLevelOrderTraversal() override = default;
+
+	void traverse(const std::shared_ptr<InventoryComponent>& component,
+				  std::vector<std::shared_ptr<InventoryComponent>>& collection) const override;
+	void traverse(const ComponentTree& tree, ComponentTree::Handle root,
+				  std::vector<ComponentTree::Handle>& collection) const override;
+
+private:
+	TraversalFilter filter;
+};
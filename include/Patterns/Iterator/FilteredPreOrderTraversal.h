@@ -0,0 +1,29 @@
+#pragma once
+#include "TraversalStrategy.h"
+#include "TraversalFilter.h"
+#include <memory>
+
+// Forward declaration
+class InventoryComponent;
+
+/**
+ * @class FilteredPreOrderTraversal
+ * @brief A TraversalStrategy that visits the root first, then children in order, yielding only
+ * the components a TraversalFilter matches.
+ *
+ * Produces the matching subsequence of PreOrderTraversal's order, except that
+ * subtrees the filter's bound rules out are never entered.
+ */
+class FilteredPreOrderTraversal : public TraversalStrategy {
+public:
+	explicit FilteredPreOrderTraversal(TraversalFilter filter);
+	~FilteredPreOrderTraversal() override = default;
+
+	void traverse(const std::shared_ptr<InventoryComponent>& component,
+				  std::vector<std::shared_ptr<InventoryComponent>>& collection) const override;
+	void traverse(const ComponentTree& tree, ComponentTree::Handle root,
+				  std::vector<ComponentTree::Handle>& collection) const override;
+
+private:
+	TraversalFilter filter;
+};
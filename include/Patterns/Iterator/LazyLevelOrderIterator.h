@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class InventoryComponent;
+class Group;
+
+/**
+ * @class LazyLevelOrderIterator
+ * @brief Level-order walk that produces each component on demand.
+ *
+ * Visits the same components in the same order as a CompositeIterator with a
+ * LevelOrderTraversal, one root's subtree after another. Only the groups still
+ * to be expanded are queued, O(width) memory, and raw pointers are yielded
+ * instead of shared_ptr copies.
+ *
+ * The same rules as LazyPreOrderIterator apply: the pointers are non-owning and
+ * the tree must not change while the walk is in progress.
+ */
+class LazyLevelOrderIterator {
+public:
+	explicit LazyLevelOrderIterator(InventoryComponent* root);
+	// Walks each root's subtree in turn (used for the Inventory's top-level components).
+	explicit LazyLevelOrderIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots);
+
+	// Returns the next component, or nullptr when the walk is over.
+	InventoryComponent* next();
+	bool hasNext() const noexcept { return upcoming != nullptr; }
+
+private:
+	// Finds the component after 'upcoming' in level order.
+	void advance();
+
+	const std::vector<std::shared_ptr<InventoryComponent>>* roots{nullptr};
+	std::size_t nextRoot{0};
+	// Groups reached but not yet expanded; the front one is being expanded.
+	std::deque<const Group*> pending;
+	std::size_t member{0};
+	InventoryComponent* upcoming{nullptr};
+};
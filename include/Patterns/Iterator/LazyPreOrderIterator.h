@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class InventoryComponent;
+class Group;
+
+/**
+ * @class LazyPreOrderIterator
+ * @brief Pre-order walk that produces each component on demand.
+ *
+ * Visits the same components in the same order as a CompositeIterator with a
+ * PreOrderTraversal (group members, views included), but keeps only an explicit
+ * stack of (group, next member) frames, O(depth) memory, instead of flattening
+ * the subtree up front, and yields raw pointers instead of shared_ptr copies.
+ *
+ * The pointers are non-owning and the walk reads live member lists: do not add,
+ * remove or destroy components while iterating. Callers that mutate the tree
+ * as they go need the CompositeIterator snapshot instead.
+ */
+class LazyPreOrderIterator {
+public:
+	explicit LazyPreOrderIterator(InventoryComponent* root);
+	// Walks each root in turn (used for the Inventory's top-level components).
+	explicit LazyPreOrderIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots);
+
+	// Returns the next component, or nullptr when the walk is over.
+	InventoryComponent* next();
+	bool hasNext() const noexcept { return upcoming != nullptr; }
+
+private:
+	struct Frame {
+		const Group* group;
+		std::size_t member;
+	};
+
+	// Finds the component after 'upcoming' in pre-order.
+	void advance();
+
+	const std::vector<std::shared_ptr<InventoryComponent>>* roots{nullptr};
+	std::size_t nextRoot{0};
+	std::vector<Frame> stack;
+	InventoryComponent* upcoming{nullptr};
+};
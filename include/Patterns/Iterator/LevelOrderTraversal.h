@@ -16,4 +16,6 @@ public:
 
 	void traverse(const std::shared_ptr<InventoryComponent>& component,
 				  std::vector<std::shared_ptr<InventoryComponent>>& collection) const override;
+	void traverse(const ComponentTree& tree, ComponentTree::Handle root,
+				  std::vector<ComponentTree::Handle>& collection) const override;
 };
@@ -0,0 +1,47 @@
+#pragma once
+#include "../../Components/Group.h"
+#include <cstdint>
+#include <functional>
+
+// Forward declarations
+class InventoryComponent;
+class Plant;
+
+/**
+ * @struct TraversalFilter
+ * @brief What a filtered traversal yields and which subtrees it may skip.
+ *
+ * 'matches' selects the components to yield. 'mayContain' is a bound over an
+ * owning Group's cached subtree aggregates: when it returns false, nothing below
+ * that group can match and the whole subtree is skipped (the group itself is
+ * still tested with 'matches'). The bound must never reject a subtree holding a
+ * match; a null bound never prunes. Views are not bounded, their aggregates cost
+ * a walk of their members.
+ *
+ * The aggregates of an owning group cover its owned subtree only, so view
+ * members nested under a pruned group are skipped with it. After plant state or
+ * the tree changed, the first bound check rebuilds the aggregates of the groups
+ * above the change (see Group::getAggregates()); scans cost roughly the number
+ * of matches plus the groups on their paths.
+ */
+struct TraversalFilter {
+	using Match = std::function<bool(const InventoryComponent&)>;
+	using Bound = std::function<bool(const Group::Aggregates&)>;
+
+	Match matches;
+	Bound mayContain;
+
+	TraversalFilter(Match matches, Bound mayContain = nullptr);
+
+	// Whether a traversal has to look below 'group'.
+	bool mayDescend(const Group& group) const;
+
+	// Plants, decorated or not, for which 'predicate' holds, pruned by 'mayContain'.
+	static TraversalFilter plants(std::function<bool(const Plant&)> predicate, Bound mayContain = nullptr);
+	// Plants with a water level below 'level'.
+	static TraversalFilter waterBelow(int32_t level);
+	// Plants with health below 'level'.
+	static TraversalFilter healthBelow(int32_t level);
+	// Plants in lifecycle stage 'stage'.
+	static TraversalFilter inStage(LifecycleStage stage);
+};
@@ -2,6 +2,7 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include "../../Components/ComponentTree.h"
 
 // Forward declaration
 class InventoryComponent;
@@ -21,4 +22,10 @@ public:
     // should not modify the state of the strategy itself; mark const for clarity.
     virtual void traverse(const std::shared_ptr<InventoryComponent>& component,
                           std::vector<std::shared_ptr<InventoryComponent>>& collection) const = 0;
+
+    // Handle-based variant over the ownership tree: appends the nodes of the subtree
+    // under 'root' in traversal order. Views are not tree edges, so their members are
+    // not followed; no shared_ptr is copied.
+    virtual void traverse(const ComponentTree& tree, ComponentTree::Handle root,
+                          std::vector<ComponentTree::Handle>& collection) const = 0;
 };
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Group;
+class Inventory;
+class InventoryComponent;
+
+/**
+ * @class InventorySnapshot
+ * @brief Immutable, persistent record of an inventory: one node per component.
+ *
+ * A node holds its component's serialize() text and, for groups, the nodes of
+ * the members in member order. Nodes are never modified once a capture returns,
+ * so successive snapshots share every node whose subtree did not change: a
+ * snapshot taken after a few hundred plants changed holds new nodes only for
+ * those plants and the groups on their paths to the top level (see
+ * SnapshotRecorder). Holding an old snapshot keeps its nodes alive and
+ * unchanged.
+ */
+class InventorySnapshot {
+public:
+	struct Node;
+	using NodePtr = std::shared_ptr<const Node>;
+
+	struct Node {
+		// The component recorded; compared against, never dereferenced.
+		const InventoryComponent* source{nullptr};
+		uint64_t id{0};
+		std::string record; // source->serialize() at capture time
+		std::vector<NodePtr> members;
+		bool group{false};
+		// This node or one below it is re-checked by every capture (see SnapshotRecorder).
+		bool volatileSubtree{false};
+	};
+
+	explicit InventorySnapshot(std::vector<NodePtr> roots) : roots(std::move(roots)) {}
+
+	// Nodes of the inventory's top-level components, in order.
+	const std::vector<NodePtr>& topLevel() const noexcept { return roots; }
+
+	/**
+	 * @brief Appends the snapshot's parts of the memento JSON (shape in HEADER_GUIDE.md).
+	 *
+	 * 'roots' gets the top-level ids; 'components' every distinct node's record in
+	 * pre-order; 'groups' one {"id","members"} entry per group, in the same order.
+	 * Each is a comma-separated list body.
+	 */
+	void appendJson(std::string& rootIds, std::string& components, std::string& groups) const;
+
+private:
+	std::vector<NodePtr> roots;
+};
+
+/**
+ * @class SnapshotRecorder
+ * @brief Captures InventorySnapshots, sharing unchanged subtrees with its earlier captures.
+ *
+ * The recorder remembers the node it last recorded for every ComponentTree node.
+ * On the next capture a component whose subtree carries no change stamp newer
+ * than that record (ComponentTree::changedAt()) reuses the node, and with it the
+ * whole subtree, without being visited; only the changed paths are serialized
+ * again. A re-checked component whose record comes out the same also keeps its
+ * old node, so the memory a capture adds scales with what changed.
+ *
+ * Changes are stamped by Plant's setters, by group membership changes and by
+ * setId(). A few things bypass the stamps and are handled coarsely:
+ * - a PlantStore tick or fast-forward counts as a change to every plant, so the
+ *   next capture re-checks the whole inventory;
+ * - decorators (whose wrapped plant is outside the ownership tree), components of
+ *   kind Other, reference groups and predicate views are re-checked by every
+ *   capture, and so is the path above them;
+ * - ComponentTree::defragment() renumbers the nodes, so the next capture records
+ *   everything afresh.
+ *
+ * A recorder follows the rules for mutating Groups: one capture at a time, with
+ * the inventory left alone meanwhile. It keeps its last record per tree node,
+ * which holds about one snapshot's worth of nodes alive.
+ */
+class SnapshotRecorder {
+public:
+	struct Stats {
+		uint64_t visited{0};  // Components examined.
+		uint64_t recorded{0}; // New nodes (components serialized into a fresh node).
+		uint64_t shared{0};   // Nodes, each with its whole subtree, taken over from earlier captures.
+	};
+
+	SnapshotRecorder() = default;
+	SnapshotRecorder(const SnapshotRecorder&) = delete;
+	SnapshotRecorder& operator=(const SnapshotRecorder&) = delete;
+
+	std::shared_ptr<const InventorySnapshot> capture(const Inventory& inventory);
+
+	// Counters of the most recent capture().
+	const Stats& lastCapture() const noexcept { return stats; }
+
+private:
+	struct Entry {
+		InventorySnapshot::NodePtr node;
+		uint32_t epoch{0}; // capture epoch through which 'node' is known to be current
+	};
+
+	// The current node for 'component', recording it (and whatever changed below it) if needed.
+	InventorySnapshot::NodePtr record(const InventoryComponent& component);
+
+	std::vector<Entry> entries; // indexed by ComponentTree handle
+	// Reference groups and views of the running capture; their members are filled in last.
+	std::vector<std::pair<std::shared_ptr<InventorySnapshot::Node>, const Group*>> pendingViews;
+	uint32_t epoch{0};
+	Stats stats;
+};
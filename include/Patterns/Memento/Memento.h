@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include "InventorySnapshot.h"
 
 /**
  * @class Memento
@@ -16,8 +18,15 @@ class Memento {
 public:
 	struct NurseryState {
 		int day;
-		// TODO: expand with serializable inventory, staff, and other data
-		std::string serializedData; // placeholder for a full serialization blob
+		// JSON snapshot (shape documented in HEADER_GUIDE.md), as read back by SaveSystem::load().
+		std::string serializedData;
+
+		// Nursery::createMemento() fills these instead, so taking a snapshot copies only what
+		// changed since the previous one: the inventory as a persistent tree sharing unchanged
+		// subtrees with earlier snapshots, the seed and the scheduled commands (a JSON list body).
+		uint64_t seed{0};
+		std::shared_ptr<const InventorySnapshot> inventory;
+		std::string commands;
 	};
 
 private:
@@ -28,4 +37,7 @@ public:
 	~Memento() = default;
 
 	NurseryState getState() const noexcept;
+
+	// The snapshot as the JSON document of HEADER_GUIDE.md (serializedData when there is no inventory tree).
+	std::string serialize() const;
 };
@@ -1,10 +1,12 @@
 
 #pragma once
 #include "Observer.h"
+#include "PlantEventBus.h"
 #include <memory>
 
-// Forward declaration
+// Forward declarations
 class Nursery;
+class Plant;
 
 /**
  * @class NurserySupervisor
@@ -14,8 +16,16 @@ class Nursery;
  * into an actionable Command. It observes a Plant, and when its update() method
  * is called, it inspects the Plant's state and creates the appropriate Command
  * (e.g., WaterPlantCommand), adding it to the Nursery's central request queue.
+ *
+ * The Nursery subscribes it to its PlantEventBus, so after each day tick it
+ * gets every changed plant in one batch and decides on all of them in one pass.
+ * The bus carries every ticked plant; the supervisor only acts on the plants it
+ * was asked to watch (Nursery::stockPlant() does so for each plant it stocks).
+ * The mark lives in the plant's store slot (Plant::isWatched()), so it follows
+ * the plant through id changes and goes with it when it is sold or destroyed.
  */
-class NurserySupervisor : public Observer, public std::enable_shared_from_this<NurserySupervisor> {
+class NurserySupervisor : public Observer, public PlantEventObserver,
+	public std::enable_shared_from_this<NurserySupervisor> {
 private:
 	// Use a weak_ptr to avoid ownership cycles; the Nursery owns the supervisor.
 	std::weak_ptr<Nursery> nursery;
@@ -24,6 +34,21 @@ public:
 	NurserySupervisor(const std::shared_ptr<Nursery>& nursery);
 	~NurserySupervisor() override = default;
 
+	// Adds 'plant' to / removes it from the plants the batched update() acts on.
+	// Plants attached with Plant::attach() are watched through their own notify().
+	void watch(Plant& plant);
+	void unwatch(Plant& plant);
+	bool isWatching(const Plant& plant) const;
+
 	void update(const std::shared_ptr<Subject>& subject) override;
+
+	/**
+	 * @brief Queues a watering for every watched plant in 'events' that is left thirsty and not withered.
+	 *
+	 * The records decide most plants without touching them (a plant whose water
+	 * rose past the threshold or which withered needs nothing); only the rest
+	 * are read.
+	 */
+	void update(const std::vector<PlantEvent>& events) override;
 };
 
@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Plant;
+
+/**
+ * @struct PlantEvent
+ * @brief One compact change record: a field of a plant moved from 'before' to 'after'.
+ *
+ * Stages are recorded as their LifecycleStage value. 'plant' saves observers a
+ * lookup by id; it is only valid until the batch holding the record has been
+ * delivered (see PlantEventBus).
+ */
+struct PlantEvent {
+	enum class Field : uint8_t { Age, Health, WaterLevel, Stage };
+
+	Plant* plant{nullptr};
+	uint64_t plantId{0};
+	int32_t before{0};
+	int32_t after{0};
+	Field field{Field::Age};
+};
+
+/**
+ * @interface PlantEventObserver
+ * @brief Receives the plant events of a PlantEventBus one batch at a time.
+ */
+class PlantEventObserver {
+public:
+	virtual ~PlantEventObserver() = default;
+	// One call per PlantEventBus::publish(): the coalesced events, ordered by plant id, then field.
+	virtual void update(const std::vector<PlantEvent>& events) = 0;
+};
+
+/**
+ * @class PlantEventBus
+ * @brief Collects plant change records from any thread and hands them to observers in batches.
+ *
+ * record() appends to a buffer owned by the calling thread, so producers never
+ * contend. publish() merges the buffers, coalesces every run of records for
+ * the same plant and field into one (the first 'before' and the last 'after',
+ * dropped when they are equal), orders the result by plant id and delivers it
+ * to each subscriber with a single call. The order does not depend on which
+ * thread recorded what, so a batch built by a parallel tick is the same as a
+ * serial one.
+ *
+ * Call publish() only while no thread is recording (e.g. at the end of a
+ * phase), and keep every recorded plant alive until it returns. Records of
+ * one plant should come from one thread per batch; the order between threads
+ * is unspecified.
+ */
+class PlantEventBus {
+public:
+	PlantEventBus();
+	~PlantEventBus();
+	PlantEventBus(const PlantEventBus&) = delete;
+	PlantEventBus& operator=(const PlantEventBus&) = delete;
+
+	// Subscribers are held weakly; expired ones are dropped on the next publish().
+	void subscribe(const std::shared_ptr<PlantEventObserver>& observer);
+	void unsubscribe(const std::shared_ptr<PlantEventObserver>& observer);
+	// Producers may skip building records while this is false.
+	bool hasSubscribers() const noexcept { return subscribed.load(std::memory_order_acquire); }
+
+	// Appends 'event' to the calling thread's buffer. Thread-safe and lock-free after a thread's first call.
+	void record(const PlantEvent& event);
+
+	// Coalesces everything recorded since the last call and delivers it; returns the number of events delivered.
+	std::size_t publish();
+
+	// Records taken and events delivered since the bus was created.
+	uint64_t recordedCount() const noexcept { return recorded; }
+	uint64_t deliveredCount() const noexcept { return delivered; }
+
+private:
+	struct Buffer {
+		std::vector<PlantEvent> events;
+	};
+
+	// The calling thread's buffer, created and registered on its first record(). Threads hold
+	// their buffers weakly, so the entries of destroyed buses can be dropped.
+	Buffer& localBuffer();
+
+	const uint64_t serial; // tells this bus apart from a destroyed one at the same address
+	std::mutex buffersMutex;
+	std::vector<std::shared_ptr<Buffer>> buffers;
+	std::vector<PlantEvent> batch;   // reused by publish()
+	std::vector<PlantEvent> scratch; // publish()'s sort buffer
+	std::vector<std::weak_ptr<PlantEventObserver>> subscribers;
+	std::atomic<bool> subscribed{false};
+	uint64_t recorded{0};
+	uint64_t delivered{0};
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "LifecycleRules.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct LifecycleCounters
+ * @brief Population and transition counts gathered while advancing stages.
+ *
+ * Filled by LifecycleEngine::advance() as a by-product of the transition pass,
+ * so reporting costs no extra walk over the plants. Counters from independent
+ * tick units can be merged with operator+=.
+ */
+struct LifecycleCounters {
+    // Plants in each stage once the pass finished (indexed by LifecycleStage).
+    std::array<uint64_t, kLifecycleStageCount> population{};
+    // Plants moved by each row of LifecycleRules::kTransitions.
+    std::array<uint64_t, LifecycleRules::kTransitionCount> ruleHits{};
+
+    void clear() noexcept;
+    LifecycleCounters& operator+=(const LifecycleCounters& other) noexcept;
+
+    uint64_t count(LifecycleStage stage) const noexcept { return population[static_cast<std::size_t>(stage)]; }
+    // Plants that moved from 'from' to 'to' (summed over every matching table row).
+    uint64_t transitions(LifecycleStage from, LifecycleStage to) const noexcept;
+    uint64_t totalTransitions() const noexcept;
+};
+
+/**
+ * @class LifecycleEngine
+ * @brief Compiled lifecycle state machine driven by LifecycleRules::kTransitions.
+ *
+ * Plants carry a one-byte LifecycleStage tag; this engine moves tags along the
+ * constexpr transition table without touching any PlantState object, so a stage
+ * change costs no allocation. The per-plant State pattern path uses the scalar
+ * LifecycleRules::nextStage(), which reads the same table.
+ */
+class LifecycleEngine {
+public:
+    /**
+     * @brief Advances 'count' stage tags to their next stage.
+     *
+     * Tags outside [0, kLifecycleStageCount) (free slots) are left untouched and
+     * not counted. 'changedBit' is OR-ed into events[i] for every slot that moved.
+     * @param counters Optional; receives population and per-row transition counts.
+     */
+    static void advance(std::size_t count, uint8_t* stages, const int32_t* ages, const int32_t* healths,
+                        uint8_t* events, uint8_t changedBit, LifecycleCounters* counters);
+};
@@ -0,0 +1,119 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum LifecycleStage
+ * @brief One-byte tag naming the lifecycle stage a plant is in.
+ *
+ * The values double as indices into LifecycleRules::kStageRules and as the
+ * stage column stored by PlantStore.
+ */
+enum class LifecycleStage : uint8_t { Seedling, Growing, Mature, Withering, Withered };
+
+constexpr std::size_t kLifecycleStageCount = 5;
+
+/**
+ * @struct StageRule
+ * @brief Per-stage numbers applied once per simulated day.
+ */
+struct StageRule {
+    int32_t waterUse;   // Water lost per day on top of the species' own thirst.
+    int32_t dryDamage;  // Health lost per day while the soil is below kDryThreshold.
+    int32_t recovery;   // Health regained per day while the soil is wet enough.
+};
+
+/**
+ * @namespace LifecycleRules
+ * @brief The daily care model shared by the PlantState classes and the PlantStore kernel.
+ *
+ * Both the per-plant State pattern path and the batched columnar tick read their
+ * numbers from here so the two paths produce identical results. Daily effects are
+ * a per-stage table (kStageRules) and stage changes a constexpr transition table
+ * (kTransitions) evaluated by LifecycleEngine.
+ */
+namespace LifecycleRules {
+
+constexpr int32_t kMaxLevel = 100;          // Upper bound for health and water level.
+constexpr int32_t kDryThreshold = 25;       // Water below this damages health.
+constexpr int32_t kThirstyThreshold = 30;   // Crossing below this notifies observers.
+constexpr int32_t kWitheringHealth = 40;    // Living plants below this start withering.
+constexpr int32_t kRecoveredHealth = 70;    // Withering plants at or above this recover.
+constexpr int32_t kGrowingAge = 7;
+constexpr int32_t kMatureAge = 30;
+constexpr int32_t kMaxWeatherLoss = 2;      // Extra daily evaporation drawn per plot, in [0, this].
+
+constexpr std::array<StageRule, kLifecycleStageCount> kStageRules{{
+    {2, 8, 4},  // Seedling
+    {3, 6, 3},  // Growing
+    {3, 5, 2},  // Mature
+    {2, 6, 2},  // Withering
+    {0, 0, 0},  // Withered: inert, never ticked
+}};
+
+constexpr const StageRule& rule(LifecycleStage stage) {
+    return kStageRules[static_cast<std::size_t>(stage)];
+}
+
+/**
+ * @struct TransitionRule
+ * @brief One row of the lifecycle transition table.
+ *
+ * A plant in stage 'from' whose age and health both fall inside the inclusive
+ * ranges moves to stage 'to'. Rows are tried in table order; the first match wins.
+ */
+struct TransitionRule {
+    LifecycleStage from;
+    int32_t minAge;
+    int32_t maxAge;
+    int32_t minHealth;
+    int32_t maxHealth;
+    LifecycleStage to;
+};
+
+constexpr int32_t kUnbounded = 0x3FFFFFFF;
+
+constexpr std::array<TransitionRule, 9> kTransitions{{
+    {LifecycleStage::Seedling, 0, kUnbounded, 0, kWitheringHealth - 1, LifecycleStage::Withering},
+    {LifecycleStage::Seedling, kGrowingAge, kUnbounded, 0, kMaxLevel, LifecycleStage::Growing},
+    {LifecycleStage::Growing, 0, kUnbounded, 0, kWitheringHealth - 1, LifecycleStage::Withering},
+    {LifecycleStage::Growing, kMatureAge, kUnbounded, 0, kMaxLevel, LifecycleStage::Mature},
+    {LifecycleStage::Mature, 0, kUnbounded, 0, kWitheringHealth - 1, LifecycleStage::Withering},
+    {LifecycleStage::Withering, 0, kUnbounded, 0, 0, LifecycleStage::Withered},
+    {LifecycleStage::Withering, 0, kGrowingAge - 1, kRecoveredHealth, kMaxLevel, LifecycleStage::Seedling},
+    {LifecycleStage::Withering, kGrowingAge, kMatureAge - 1, kRecoveredHealth, kMaxLevel, LifecycleStage::Growing},
+    {LifecycleStage::Withering, kMatureAge, kUnbounded, kRecoveredHealth, kMaxLevel, LifecycleStage::Mature},
+}};
+
+constexpr std::size_t kTransitionCount = kTransitions.size();
+
+// Stage a plant should be in after a day ends with the given age and health.
+constexpr LifecycleStage nextStage(LifecycleStage stage, int32_t age, int32_t health) {
+    for (const TransitionRule& row : kTransitions) {
+        if (row.from == stage && age >= row.minAge && age <= row.maxAge
+            && health >= row.minHealth && health <= row.maxHealth) {
+            return row.to;
+        }
+    }
+    return stage;
+}
+
+constexpr bool hasOutgoingRule(LifecycleStage stage) {
+    for (const TransitionRule& row : kTransitions) {
+        if (row.from == stage) return true;
+    }
+    return false;
+}
+
+static_assert(!hasOutgoingRule(LifecycleStage::Withered), "Withered must be terminal");
+static_assert(nextStage(LifecycleStage::Seedling, kGrowingAge, kMaxLevel) == LifecycleStage::Growing,
+              "healthy seedlings grow up at kGrowingAge");
+static_assert(nextStage(LifecycleStage::Seedling, kGrowingAge, kWitheringHealth - 1) == LifecycleStage::Withering,
+              "withering takes priority over growing up");
+static_assert(nextStage(LifecycleStage::Withering, kMatureAge, kRecoveredHealth) == LifecycleStage::Mature,
+              "recovered plants return to the stage matching their age");
+static_assert(nextStage(LifecycleStage::Withering, kMatureAge, kRecoveredHealth - 1) == LifecycleStage::Withering,
+              "recovery needs kRecoveredHealth");
+
+} // namespace LifecycleRules
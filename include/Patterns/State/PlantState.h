@@ -1,5 +1,6 @@
 
 #pragma once
+#include "LifecycleRules.h"
 #include <memory>
 
 // Forward declaration to break circular dependency.
@@ -12,7 +13,11 @@ class Plant;
  * This interface defines the contract that all concrete state classes must follow.
  * It declares the methods that the Plant (the "Context") will delegate to its
  * current state object. This allows the Plant's behavior to change dynamically
- * as its state object is swapped out.
+ * as its state changes.
+ *
+ * Concrete states are stateless, shared behaviours: a Plant only stores a one-byte
+ * LifecycleStage tag and looks its behaviour up with forStage(), so changing state
+ * or snapshotting a plant never allocates.
  */
 class PlantState {
 public:
@@ -22,22 +27,32 @@ public:
      * @brief Handles the logic for transitioning out of the current state.
      * @param plant A pointer to the context (the Plant object).
      */
-    virtual void handleStateChange(Plant* plant) = 0;
+    virtual void handleStateChange(Plant* plant) const = 0;
 
     /**
      * @brief Contains the core logic that is executed each day the Plant is in this state.
      * @param plant A pointer to the context (the Plant object).
      */
-    virtual void performDailyActivity(Plant* plant) = 0;
+    virtual void performDailyActivity(Plant* plant) const = 0;
 
     /**
-     * @brief (Prototype Pattern) Allows state objects to be cloned.
-     * 
-     * This is necessary for the Plant's clone method to perform a deep copy.
-     * When a Plant is cloned, its current state must also be cloned.
-     * @return A unique_ptr to a new PlantState instance.
+     * @brief The lifecycle stage tag this state represents.
      */
-    virtual std::unique_ptr<PlantState> clone() const = 0;
-};
+    virtual LifecycleStage stage() const = 0;
+
+    /**
+     * @brief Returns the shared behaviour object for a lifecycle stage tag.
+     */
+    static const PlantState& forStage(LifecycleStage stage);
+
+protected:
+    PlantState() = default;
+    PlantState(const PlantState&) = delete;
+    PlantState& operator=(const PlantState&) = delete;
 
+    // Applies one day of LifecycleRules for 'stage' to the plant (age, water, health).
+    static void applyDailyRule(Plant* plant, LifecycleStage stage);
 
+    // Moves the plant to LifecycleRules::nextStage() if it differs from 'stage'.
+    static void advanceStage(Plant* plant, LifecycleStage stage);
+};
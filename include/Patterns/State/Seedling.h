@@ -5,7 +5,7 @@ class Seedling : public PlantState {
 public:
     Seedling();
     ~Seedling() override = default;
-    void handleStateChange(Plant* plant) override;
-    void performDailyActivity(Plant* plant) override;
-    std::unique_ptr<PlantState> clone() const override;
+    void handleStateChange(Plant* plant) const override;
+    void performDailyActivity(Plant* plant) const override;
+    LifecycleStage stage() const override;
 };
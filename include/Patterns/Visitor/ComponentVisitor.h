@@ -0,0 +1,93 @@
+#pragma once
+#include "../../Components/Cactus.h"
+#include "../../Components/ComponentTree.h"
+#include "../../Components/Group.h"
+#include "../../Components/InventoryComponent.h"
+#include "../../Components/Rose.h"
+#include "../Decorator/DecoratedItem.h"
+#include "../Decorator/GiftWrapDecorator.h"
+#include "../Decorator/PlantDecorator.h"
+#include "../Decorator/PotDecorator.h"
+#include "../Decorator/RibbonDecorator.h"
+#include <type_traits>
+
+/**
+ * Static dispatch over the closed set of component types.
+ *
+ * visitComponent() switches on InventoryComponent::kind() and calls the visitor
+ * with the component cast to its concrete type: Group, Rose, Cactus,
+ * PlantDecorator, PotDecorator, RibbonDecorator, GiftWrapDecorator or DecoratedItem (const
+ * when the component is), or InventoryComponent for ComponentKind::Other. The
+ * concrete types are final, so member calls the visitor makes on them are
+ * direct and can inline; build visitors from generic lambdas or Overloaded.
+ * Every call must return the same type.
+ *
+ * visitPreOrder() walks the owned subtree of a root over ComponentTree handles
+ * (as ComponentTree::forEachPreOrder(), views are not followed) and visits each
+ * component, so a tight loop over an inventory pays neither a virtual
+ * next()/hasNext() nor a vtable hop per element.
+ *
+ *   double total = 0.0;
+ *   visitPreOrder(*plot, Overloaded{
+ *       [&](const Rose& rose) { total += rose.getPrice(); },
+ *       [&](const Cactus& cactus) { total += cactus.getPrice(); },
+ *       [](const auto&) {}});
+ */
+
+// Combines lambdas into one visitor: Overloaded{[](const Rose&) {...}, [](const auto&) {...}}.
+template <typename... Fns>
+struct Overloaded : Fns... {
+	using Fns::operator()...;
+};
+template <typename... Fns>
+Overloaded(Fns...) -> Overloaded<Fns...>;
+
+namespace visitor_detail {
+
+// 'To', const if 'From' is.
+template <typename From, typename To>
+using MatchConst = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+// Component is InventoryComponent or const InventoryComponent.
+template <typename Component, typename Visitor>
+auto dispatch(Component& component, Visitor& visitor) -> std::invoke_result_t<Visitor&, Component&> {
+	switch (component.kind()) {
+	case ComponentKind::Group: return visitor(static_cast<MatchConst<Component, Group>&>(component));
+	case ComponentKind::Rose: return visitor(static_cast<MatchConst<Component, Rose>&>(component));
+	case ComponentKind::Cactus: return visitor(static_cast<MatchConst<Component, Cactus>&>(component));
+	case ComponentKind::PlantDecorator: return visitor(static_cast<MatchConst<Component, PlantDecorator>&>(component));
+	case ComponentKind::PotDecorator: return visitor(static_cast<MatchConst<Component, PotDecorator>&>(component));
+	case ComponentKind::RibbonDecorator: return visitor(static_cast<MatchConst<Component, RibbonDecorator>&>(component));
+	case ComponentKind::GiftWrapDecorator: return visitor(static_cast<MatchConst<Component, GiftWrapDecorator>&>(component));
+	case ComponentKind::DecoratedItem: return visitor(static_cast<MatchConst<Component, DecoratedItem>&>(component));
+	case ComponentKind::Other: break;
+	}
+	return visitor(component);
+}
+
+} // namespace visitor_detail
+
+template <typename Visitor>
+decltype(auto) visitComponent(InventoryComponent& component, Visitor&& visitor) {
+	return visitor_detail::dispatch(component, visitor);
+}
+
+template <typename Visitor>
+decltype(auto) visitComponent(const InventoryComponent& component, Visitor&& visitor) {
+	return visitor_detail::dispatch(component, visitor);
+}
+
+// Visits 'root' and its owned subtree in pre-order. The tree must not change meanwhile.
+template <typename Visitor>
+void visitPreOrder(InventoryComponent& root, Visitor&& visitor) {
+	const ComponentTree& tree = ComponentTree::shared();
+	tree.forEachPreOrder(root.treeNode(), [&](ComponentTree::Handle node) { visitor_detail::dispatch(*tree.component(node), visitor); });
+}
+
+template <typename Visitor>
+void visitPreOrder(const InventoryComponent& root, Visitor&& visitor) {
+	const ComponentTree& tree = ComponentTree::shared();
+	tree.forEachPreOrder(root.treeNode(), [&](ComponentTree::Handle node) {
+		visitor_detail::dispatch(static_cast<const InventoryComponent&>(*tree.component(node)), visitor);
+	});
+}
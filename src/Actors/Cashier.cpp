@@ -3,7 +3,16 @@
 
 Cashier::Cashier() = default;
 
-void Cashier::handleRequest(std::unique_ptr<Command> cmd) {
-	(void)cmd; // stub
+const char* Cashier::roleName() const noexcept { return "Cashier"; }
+
+bool Cashier::canHandle(Command::Kind kind) const noexcept {
+	return kind == Command::Kind::FulfillCustomer;
 }
 
+void Cashier::handleRequest(std::unique_ptr<Command> cmd) {
+	if (cmd && canHandle(cmd->kind())) {
+		perform(std::move(cmd));
+		return;
+	}
+	passToSuccessor(std::move(cmd));
+}
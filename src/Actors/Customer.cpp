@@ -1,4 +1,8 @@
 #include "../../include/Actors/Customer.h"
+#include "../../include/Components/InventoryComponent.h"
 
 Customer::Customer() = default;
 
+void Customer::receive(const std::shared_ptr<InventoryComponent>& item) {
+	if (item) purchases.push_back(item);
+}
@@ -3,7 +3,16 @@
 
 Gardener::Gardener() = default;
 
-void Gardener::handleRequest(std::unique_ptr<Command> cmd) {
-	(void)cmd; // stub: real logic implemented later
+const char* Gardener::roleName() const noexcept { return "Gardener"; }
+
+bool Gardener::canHandle(Command::Kind kind) const noexcept {
+	return kind == Command::Kind::WaterPlant || kind == Command::Kind::BatchWater;
 }
 
+void Gardener::handleRequest(std::unique_ptr<Command> cmd) {
+	if (cmd && canHandle(cmd->kind())) {
+		perform(std::move(cmd));
+		return;
+	}
+	passToSuccessor(std::move(cmd));
+}
@@ -1,6 +1,19 @@
 #include "../../include/Actors/Staff.h"
+#include "../../include/Patterns/Command/Command.h"
 
-Staff::Staff() = default;
+Staff::Staff() : dailyCapacity(kUnlimited) {}
+
+void Staff::perform(std::unique_ptr<Command> cmd) {
+	if (cmd) cmd->execute();
+}
 
 void Staff::setSuccessor(const std::shared_ptr<Staff>& next) noexcept { successor = next; }
 
+void Staff::passToSuccessor(std::unique_ptr<Command> cmd) {
+	if (!cmd) return;
+	if (successor) {
+		successor->handleRequest(std::move(cmd));
+		return;
+	}
+	cmd->setStatus(Command::Status::Failed);
+}
@@ -0,0 +1,43 @@
+#include "../../include/Components/Cactus.h"
+
+#include <algorithm>
+
+namespace {
+constexpr int kCactusThirst = 1;     // water lost per day on top of the stage rule
+constexpr int kCactusWaterDose = 20; // water added by one watering
+}
+
+Cactus::Cactus(Symbol name, double price, std::shared_ptr<PlantStore> store)
+	: Plant(name, price, kCactusThirst, std::move(store)) {
+	kind_ = ComponentKind::Cactus;
+}
+
+void Cactus::water() {
+	if (getStage() == LifecycleStage::Withered) return;
+	setWaterLevel(std::min(LifecycleRules::kMaxLevel, getWaterLevel() + kCactusWaterDose));
+}
+
+void Cactus::waterAll(Cactus* const* cacti, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) cacti[i]->Cactus::water();
+}
+
+WaterLevel Cactus::getWaterRequirement() const { return LOW; }
+
+SunLevel Cactus::getSunRequirement() const { return FULL; }
+
+std::shared_ptr<InventoryComponent> Cactus::clone() const {
+	// Snapshot copies live in the archive store so the daily tick never advances them.
+	auto copy = std::make_shared<Cactus>(getNameSymbol(), getPrice(), PlantStore::archive());
+	copy->copyRuntimeStateFrom(*this);
+	return copy;
+}
+
+std::shared_ptr<InventoryComponent> Cactus::blueprintClone() const {
+	return std::make_shared<Cactus>(getNameSymbol(), getPrice(), getStore());
+}
+
+std::string Cactus::serialize() const { return Plant::serialize(); }
+
+void Cactus::deserialize(const std::string& data) { Plant::deserialize(data); }
+
+std::string_view Cactus::typeNameView() const { return "Cactus"; }
@@ -0,0 +1,161 @@
+#include "../../include/Components/ComponentRegistry.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr std::size_t kInitialSlots = 256;
+
+} // namespace
+
+ComponentRegistry& ComponentRegistry::shared() {
+	static ComponentRegistry* const registry = new ComponentRegistry();
+	return *registry;
+}
+
+std::size_t ComponentRegistry::home(const Table& table, uint64_t id) noexcept {
+	// Fibonacci hashing spreads the consecutive ids of a block over the whole table.
+	return static_cast<std::size_t>((id * 0x9E3779B97F4A7C15ull) >> 32) & table.mask;
+}
+
+void ComponentRegistry::beginWrite(Shard& shard) noexcept {
+	shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void ComponentRegistry::endWrite(Shard& shard) noexcept {
+	shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void ComponentRegistry::grow(Shard& shard) {
+	const Table* old = shard.table.load(std::memory_order_relaxed);
+	auto table = std::make_unique<Table>(old ? (old->mask + 1) * 2 : kInitialSlots);
+	if (old) {
+		for (std::size_t i = 0; i <= old->mask; ++i) {
+			const uint64_t id = old->slots[i].id.load(std::memory_order_relaxed);
+			if (id == 0) continue;
+			std::size_t slot = home(*table, id);
+			while (table->slots[slot].id.load(std::memory_order_relaxed) != 0) slot = (slot + 1) & table->mask;
+			table->slots[slot].id.store(id, std::memory_order_relaxed);
+			table->slots[slot].component.store(old->slots[i].component.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+	// The old table stays allocated: a lookup that loaded it retries once it sees the sequence move.
+	shard.table.store(table.get(), std::memory_order_relaxed);
+	shard.tables.push_back(std::move(table));
+}
+
+bool ComponentRegistry::insert(uint64_t id, InventoryComponent* component) {
+	if (id == 0) return false;
+	Shard& shard = shards[shardIndex(id)];
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	beginWrite(shard);
+	const Table* table = shard.table.load(std::memory_order_relaxed);
+	if (!table || (shard.count + 1) * 2 > table->mask + 1) {
+		grow(shard);
+		table = shard.table.load(std::memory_order_relaxed);
+	}
+	std::size_t slot = home(*table, id);
+	bool held = true;
+	for (uint64_t found; (found = table->slots[slot].id.load(std::memory_order_relaxed)) != 0; slot = (slot + 1) & table->mask) {
+		if (found == id) {
+			held = table->slots[slot].component.load(std::memory_order_relaxed) == component;
+			break;
+		}
+	}
+	if (table->slots[slot].id.load(std::memory_order_relaxed) == 0) {
+		table->slots[slot].component.store(component, std::memory_order_relaxed);
+		table->slots[slot].id.store(id, std::memory_order_relaxed);
+		++shard.count;
+	}
+	endWrite(shard);
+	if (!held) {
+		auto& line = shard.waiting[id];
+		if (std::find(line.begin(), line.end(), component) == line.end()) line.push_back(component);
+	}
+	return held;
+}
+
+void ComponentRegistry::erase(uint64_t id, const InventoryComponent* component) {
+	if (id == 0) return;
+	Shard& shard = shards[shardIndex(id)];
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	Table* table = shard.table.load(std::memory_order_relaxed);
+	if (!table) return;
+	const std::size_t mask = table->mask;
+	Slot* slots = table->slots.get();
+	std::size_t hole = home(*table, id);
+	for (uint64_t found; (found = slots[hole].id.load(std::memory_order_relaxed)) != id; hole = (hole + 1) & mask) {
+		if (found == 0) return;
+	}
+	const auto waiting = shard.waiting.empty() ? shard.waiting.end() : shard.waiting.find(id);
+	if (slots[hole].component.load(std::memory_order_relaxed) != component) {
+		// A holder waiting in line leaves it.
+		if (waiting == shard.waiting.end()) return;
+		auto& line = waiting->second;
+		line.erase(std::remove(line.begin(), line.end(), component), line.end());
+		if (line.empty()) shard.waiting.erase(waiting);
+		return;
+	}
+	if (waiting != shard.waiting.end()) {
+		// The oldest holder in line takes the entry over.
+		InventoryComponent* next = waiting->second.front();
+		waiting->second.erase(waiting->second.begin());
+		if (waiting->second.empty()) shard.waiting.erase(waiting);
+		beginWrite(shard);
+		slots[hole].component.store(next, std::memory_order_relaxed);
+		endWrite(shard);
+		return;
+	}
+	beginWrite(shard);
+	// Backward-shift deletion: pull later entries of the probe run into the hole so
+	// lookups never need tombstones.
+	for (std::size_t next = (hole + 1) & mask; slots[next].id.load(std::memory_order_relaxed) != 0; next = (next + 1) & mask) {
+		const uint64_t moved = slots[next].id.load(std::memory_order_relaxed);
+		const std::size_t wanted = home(*table, moved);
+		// Move the entry unless its home lies cyclically in (hole, next].
+		if (((next - wanted) & mask) >= ((next - hole) & mask)) {
+			slots[hole].id.store(moved, std::memory_order_relaxed);
+			slots[hole].component.store(slots[next].component.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			hole = next;
+		}
+	}
+	slots[hole].id.store(0, std::memory_order_relaxed);
+	slots[hole].component.store(nullptr, std::memory_order_relaxed);
+	--shard.count;
+	endWrite(shard);
+}
+
+InventoryComponent* ComponentRegistry::find(uint64_t id) const {
+	if (id == 0) return nullptr;
+	const Shard& shard = shards[shardIndex(id)];
+	for (;;) {
+		const uint64_t before = shard.sequence.load(std::memory_order_acquire);
+		if (before & 1) continue; // a writer is mid-change
+		InventoryComponent* result = nullptr;
+		if (const Table* table = shard.table.load(std::memory_order_acquire)) {
+			// A probe run ends at an empty slot, and a table is at most half full; the bound
+			// only guards against slots torn by a concurrent writer.
+			std::size_t slot = home(*table, id);
+			for (std::size_t probes = 0; probes <= table->mask; ++probes, slot = (slot + 1) & table->mask) {
+				const uint64_t found = table->slots[slot].id.load(std::memory_order_relaxed);
+				if (found == 0) break;
+				if (found == id) {
+					result = table->slots[slot].component.load(std::memory_order_relaxed);
+					break;
+				}
+			}
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (shard.sequence.load(std::memory_order_relaxed) == before) return result;
+	}
+}
+
+std::size_t ComponentRegistry::size() const {
+	std::size_t total = 0;
+	for (const Shard& shard : shards) {
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		total += shard.count;
+	}
+	return total;
+}
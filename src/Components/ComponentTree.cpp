@@ -0,0 +1,138 @@
+#include "../../include/Components/ComponentTree.h"
+#include "../../include/Components/InventoryComponent.h"
+
+#include <stdexcept>
+
+namespace {
+
+// Below this many live nodes the whole arena fits in cache and relayout buys nothing.
+constexpr std::size_t kMinDefragmentNodes = 4096;
+
+} // namespace
+
+ComponentTree& ComponentTree::shared() {
+	static ComponentTree* const tree = new ComponentTree();
+	return *tree;
+}
+
+ComponentTree::ComponentTree() : chunks(new Node*[kMaxChunks]()) {}
+
+ComponentTree::~ComponentTree() {
+	for (std::size_t chunk = 0; chunk < kMaxChunks; ++chunk) delete[] chunks[chunk];
+}
+
+ComponentTree::Handle ComponentTree::allocate(InventoryComponent* component) {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	Handle node;
+	if (!freeNodes.empty()) {
+		node = freeNodes.back();
+		freeNodes.pop_back();
+	} else {
+		const std::size_t count = nodeCount.load(std::memory_order_relaxed);
+		if (count == kMaxNodes) throw std::length_error("ComponentTree: node limit reached");
+		// Chunks are kept through defragment(), so only a never-used one needs allocating.
+		Node*& chunk = chunks[count >> kChunkBits];
+		if (!chunk) chunk = new Node[kChunkNodes];
+		node = static_cast<Handle>(count);
+		nodeCount.store(count + 1, std::memory_order_release);
+	}
+	at(node) = Node{};
+	at(node).component = component;
+	// A recycled handle must not pass for the component a snapshot recorded under it.
+	at(node).changeStamp = changeEpoch();
+	return node;
+}
+
+void ComponentTree::release(Handle node) {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	unlink(node);
+	// Children that outlive their owner become roots.
+	for (Handle child = at(node).firstChild; child != kNull;) {
+		const Handle next = at(child).nextSibling;
+		at(child).parent = kNull;
+		at(child).prevSibling = kNull;
+		at(child).nextSibling = kNull;
+		child = next;
+	}
+	at(node) = Node{};
+	freeNodes.push_back(node);
+}
+
+void ComponentTree::appendChild(Handle parent, Handle child) {
+	unlink(child);
+	markChanged(parent);
+	Node& owner = at(parent);
+	at(child).parent = parent;
+	at(child).prevSibling = owner.lastChild;
+	if (owner.lastChild != kNull) at(owner.lastChild).nextSibling = child;
+	else owner.firstChild = child;
+	owner.lastChild = child;
+	relinks.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ComponentTree::detach(Handle node) {
+	unlink(node);
+	relinks.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ComponentTree::unlink(Handle node) noexcept {
+	Node& entry = at(node);
+	if (entry.parent == kNull) return;
+	markChanged(entry.parent);
+	Node& owner = at(entry.parent);
+	if (entry.prevSibling != kNull) at(entry.prevSibling).nextSibling = entry.nextSibling;
+	else owner.firstChild = entry.nextSibling;
+	if (entry.nextSibling != kNull) at(entry.nextSibling).prevSibling = entry.prevSibling;
+	else owner.lastChild = entry.prevSibling;
+	entry.parent = kNull;
+	entry.prevSibling = kNull;
+	entry.nextSibling = kNull;
+}
+
+void ComponentTree::markChanged(Handle node) noexcept {
+	const uint32_t stamp = changeEpoch();
+	// An ancestor already stamped this epoch has had its own ancestors stamped too.
+	for (; node != kNull && at(node).changeStamp != stamp; node = at(node).parent) at(node).changeStamp = stamp;
+}
+
+std::size_t ComponentTree::size() const {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	return capacity() - freeNodes.size();
+}
+
+bool ComponentTree::fragmented() const {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	const std::size_t live = capacity() - freeNodes.size();
+	return live >= kMinDefragmentNodes && (freeNodes.size() + relinks.load(std::memory_order_relaxed)) * 4 > live;
+}
+
+void ComponentTree::defragment() {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	// remap[old] = new handle; nodes are numbered in the order the walk reaches them.
+	const std::size_t count = capacity();
+	std::vector<Handle> remap(count, kNull);
+	std::vector<Handle> order;
+	order.reserve(count - freeNodes.size());
+	for (Handle root = 0; root < count; ++root) {
+		if (!at(root).component || at(root).parent != kNull) continue;
+		forEachPreOrder(root, [&](Handle node) {
+			remap[node] = static_cast<Handle>(order.size());
+			order.push_back(node);
+		});
+	}
+
+	auto mapped = [&remap](Handle node) { return node == kNull ? kNull : remap[node]; };
+	std::vector<Node> relaid(order.size());
+	for (std::size_t index = 0; index < order.size(); ++index) {
+		const Node& old = at(order[index]);
+		relaid[index] = Node{old.component, mapped(old.parent), mapped(old.firstChild), mapped(old.lastChild),
+			mapped(old.prevSibling), mapped(old.nextSibling), old.changeStamp};
+		old.component->node_ = static_cast<Handle>(index);
+	}
+	// In place: nodes past the new count are never read again until allocate() resets them.
+	for (std::size_t index = 0; index < relaid.size(); ++index) at(static_cast<Handle>(index)) = relaid[index];
+	nodeCount.store(relaid.size(), std::memory_order_release);
+	freeNodes.clear();
+	relinks.store(0, std::memory_order_relaxed);
+	generation.fetch_add(1, std::memory_order_release);
+}
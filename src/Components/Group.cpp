@@ -1,23 +1,236 @@
 #include "../../include/Components/Group.h"
 #include "../../include/Patterns/Iterator/CompositeIterator.h"
+#include "../../include/Patterns/Iterator/PreOrderTraversal.h"
+#include "../../include/Components/Plant.h"
+#include "../../include/Components/PlantStore.h"
+#include "../../include/Core/Inventory.h"
+#include "../../include/Core/Json.h"
+#include "../../include/Patterns/Decorator/PlantDecorator.h"
 
 #include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+int64_t toCents(double price) { return std::llround(price * 100.0); }
+
+// Finds the plant behind a component, looking through any decorators.
+const Plant* plantOf(const InventoryComponent* component) {
+	while (auto decorator = dynamic_cast<const PlantDecorator*>(component)) {
+		component = decorator->getWrappedComponent().get();
+	}
+	return dynamic_cast<const Plant*>(component);
+}
+
+// What one owned child adds to its owner's price and plant count. Views own nothing and add nothing.
+struct Contribution {
+	int64_t priceCents;
+	int64_t plantCount;
+};
+
+Contribution contributionOf(const InventoryComponent& component) {
+	if (auto group = dynamic_cast<const Group*>(&component)) {
+		if (!group->owns()) return {0, 0};
+		return {group->getPriceCents(), static_cast<int64_t>(group->getPlantCount())};
+	}
+	return {toCents(component.getPrice()), plantOf(&component) ? 1 : 0};
+}
+
+// Folds one plant's state into the state fields of 'totals' (Group::Aggregates or PlantStore::RangeState).
+template <typename Totals>
+void addPlantState(Totals& totals, const Plant& plant) {
+	++totals.stageCounts[static_cast<std::size_t>(plant.getStage())];
+	totals.minHealth = std::min(totals.minHealth, static_cast<int32_t>(plant.getHealth()));
+	totals.minWaterLevel = std::min(totals.minWaterLevel, static_cast<int32_t>(plant.getWaterLevel()));
+}
+
+// Folds a subgroup's state fields into 'totals'.
+void addGroupState(Group::Aggregates& totals, const Group::Aggregates& subgroup) {
+	for (std::size_t stage = 0; stage < kLifecycleStageCount; ++stage) totals.stageCounts[stage] += subgroup.stageCounts[stage];
+	totals.minHealth = std::min(totals.minHealth, subgroup.minHealth);
+	totals.minWaterLevel = std::min(totals.minWaterLevel, subgroup.minWaterLevel);
+}
+
+// Shares ownership of a plant with whoever holds it (Plant is a Subject, which knows its shared_ptr).
+std::shared_ptr<InventoryComponent> sharedPlant(InventoryComponent* component) {
+	auto* plant = static_cast<Plant*>(component);
+	auto holder = plant->Subject::weak_from_this().lock();
+	return holder ? std::shared_ptr<InventoryComponent>(holder, component) : nullptr;
+}
+
+} // namespace
+
+struct Group::Selection {
+	Predicate predicate;
+	Inventory* scope{nullptr};
+	// Dense member list plus each member's position in it: O(1) test, insert and swap-remove.
+	std::vector<InventoryComponent*> plants;
+	std::unordered_map<const InventoryComponent*, std::size_t> positions;
+	// Plants reported by Plant::notify() since the last read.
+	std::vector<InventoryComponent*> noted;
+	std::mutex notedMutex;
+
+	void insert(InventoryComponent* plant) {
+		if (positions.emplace(plant, plants.size()).second) plants.push_back(plant);
+	}
+
+	void erase(const InventoryComponent* plant) {
+		auto found = positions.find(plant);
+		if (found == positions.end()) return;
+		const std::size_t position = found->second;
+		positions.erase(found);
+		if (position + 1 != plants.size()) {
+			plants[position] = plants.back();
+			positions[plants[position]] = position;
+		}
+		plants.pop_back();
+	}
+
+	void evaluate(InventoryComponent* plant) {
+		if (predicate(static_cast<const Plant&>(*plant))) insert(plant);
+		else erase(plant);
+	}
+
+	void applyNoted() {
+		std::lock_guard<std::mutex> lock(notedMutex);
+		if (noted.empty()) return;
+		std::sort(noted.begin(), noted.end(),
+			[](const InventoryComponent* a, const InventoryComponent* b) { return a->getId() < b->getId(); });
+		noted.erase(std::unique(noted.begin(), noted.end()), noted.end());
+		for (InventoryComponent* plant : noted) evaluate(plant);
+		noted.clear();
+	}
+};
 
 Group::Group(const std::string& name, bool ownsChildren)
-	: name(name), ownsChildren(ownsChildren) {}
+	: name(name), ownsChildren(ownsChildren) {
+	kind_ = ComponentKind::Group;
+}
+
+Group::Group(const std::string& name, Predicate predicate)
+	: name(name), ownsChildren(false), selection(std::make_unique<Selection>()) {
+	kind_ = ComponentKind::Group;
+	selection->predicate = std::move(predicate);
+}
+
+Group::~Group() {
+	if (selection && selection->scope) Inventory::registeredViews.fetch_sub(1, std::memory_order_relaxed);
+}
+
+double Group::getPrice() const { return static_cast<double>(getPriceCents()) / 100.0; }
+
+int64_t Group::getPriceCents() const { return ownsChildren ? totals.priceCents : getAggregates().priceCents; }
+
+uint64_t Group::getPlantCount() const { return ownsChildren ? totals.plantCount : getAggregates().plantCount; }
+
+Group::Aggregates Group::getAggregates() const {
+	if (ownsChildren) {
+		refreshStateTotals();
+		return totals;
+	}
+	Aggregates sum;
+	forEachMember([&sum](const InventoryComponent& member) {
+		if (auto group = dynamic_cast<const Group*>(&member)) {
+			const Aggregates subgroup = group->getAggregates();
+			sum.priceCents += subgroup.priceCents;
+			sum.plantCount += subgroup.plantCount;
+			addGroupState(sum, subgroup);
+			return;
+		}
+		sum.priceCents += toCents(member.getPrice());
+		if (const Plant* plant = plantOf(&member)) {
+			++sum.plantCount;
+			addPlantState(sum, *plant);
+		}
+	});
+	return sum;
+}
+
+void Group::propagate(int64_t priceCents, int64_t plantCount) {
+	// Only owning groups link children, so every ancestor in the tree is an owning Group.
+	// A child came or went, so the state fields are stale along the same chain.
+	plantStateStale.store(true, std::memory_order_relaxed);
+	const ComponentTree& tree = ComponentTree::shared();
+	for (auto node = treeNode(); node != ComponentTree::kNull; node = tree.parent(node)) {
+		auto* ancestor = static_cast<Group*>(tree.component(node));
+		ancestor->totals.priceCents += priceCents;
+		ancestor->totals.plantCount += static_cast<uint64_t>(plantCount);
+		ancestor->totalsStale.store(true, std::memory_order_relaxed);
+	}
+}
+
+void Group::markTotalsStale() const noexcept {
+	const ComponentTree& tree = ComponentTree::shared();
+	for (auto node = treeNode(); node != ComponentTree::kNull; node = tree.parent(node)) {
+		const auto* group = static_cast<const Group*>(tree.component(node));
+		// A stale group's ancestors are stale already.
+		if (group->totalsStale.load(std::memory_order_relaxed)) return;
+		group->totalsStale.store(true, std::memory_order_relaxed);
+	}
+}
+
+void Group::plantStateChanged(const InventoryComponent& plant) noexcept {
+	const ComponentTree& tree = ComponentTree::shared();
+	const ComponentTree::Handle owner = tree.parent(plant.treeNode());
+	if (owner == ComponentTree::kNull) {
+		// A top-level plant adds to no group; a decorated one cannot name the group owning its decorator.
+		if (!Inventory::holding(plant)) PlantStore::markStateChanged();
+		return;
+	}
+	const auto* group = static_cast<const Group*>(tree.component(owner));
+	if (!group->plantStateStale.load(std::memory_order_relaxed)) group->plantStateStale.store(true, std::memory_order_relaxed);
+	group->markTotalsStale();
+}
+
+void Group::assignPlantState(const PlantStore::RangeState& state) {
+	plantState = state;
+	plantStateStale.store(false, std::memory_order_relaxed);
+	markTotalsStale();
+}
+
+void Group::refreshStateTotals() const {
+	const uint64_t stateVersion = PlantStore::stateVersion();
+	auto stale = [stateVersion](const Group& group) {
+		return group.totalsStale.load(std::memory_order_relaxed) || group.totalsStateVersion != stateVersion;
+	};
+	if (!stale(*this)) return;
 
-// Composite overrides - minimal stubs
-std::string Group::getName() const { return name; }
+	// A current group has a current subtree, so only stale subgroups are descended into.
+	std::vector<const Group*> pending{this};
+	for (std::size_t next = 0; next < pending.size(); ++next) {
+		for (const Group* subgroup : pending[next]->ownedGroups) {
+			if (stale(*subgroup)) pending.push_back(subgroup);
+		}
+	}
+	// Reverse breadth-first order: every subgroup is brought up to date before the group holding it.
+	for (auto group = pending.rbegin(); group != pending.rend(); ++group) {
+		const bool plantsStale = (*group)->plantStateStale.exchange(false, std::memory_order_relaxed);
+		if (plantsStale || (*group)->totalsStateVersion != stateVersion) (*group)->recomputePlantState();
+		(*group)->combineStateTotals();
+		(*group)->totalsStale.store(false, std::memory_order_relaxed);
+		(*group)->totalsStateVersion = stateVersion;
+	}
+}
+
+void Group::recomputePlantState() const {
+	plantState = PlantStore::RangeState{};
+	const ComponentTree& tree = ComponentTree::shared();
+	tree.forEachChild(treeNode(), [this, &tree](ComponentTree::Handle node) {
+		if (const Plant* plant = plantOf(tree.component(node))) addPlantState(plantState, *plant);
+	});
+}
 
-double Group::getPrice() const {
-	double total = 0.0;
-	// Minimal stub: not traversing children; concrete implementation required later.
-	(void)total;
-	return 0.0;
+void Group::combineStateTotals() const {
+	totals.stageCounts = plantState.stageCounts;
+	totals.minHealth = plantState.minHealth;
+	totals.minWaterLevel = plantState.minWaterLevel;
+	for (const Group* subgroup : ownedGroups) addGroupState(totals, subgroup->totals);
 }
 
 std::unique_ptr<Iterator> Group::createIterator() {
-	return nullptr;
+	return std::make_unique<CompositeIterator>(shared_from_this(), std::make_unique<PreOrderTraversal>());
 }
 
 std::shared_ptr<InventoryComponent> Group::clone() const {
@@ -28,23 +241,223 @@ std::shared_ptr<InventoryComponent> Group::blueprintClone() const {
 	return nullptr;
 }
 
-std::string Group::serialize() const { return std::string(); }
+std::string Group::serialize() const {
+	// Membership is recorded separately (the memento's "groups" array) so restore can run in two passes.
+	return "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId())
+		+ ",\"data\":{\"name\":" + Json::quote(name) + ",\"owns\":" + (ownsChildren ? "true" : "false") + "}}";
+}
 
 void Group::deserialize(const std::string& data) { (void)data; }
 
-std::string Group::typeName() const { return "Group"; }
+std::string_view Group::typeNameView() const { return "Group"; }
 
 void Group::add(const std::shared_ptr<InventoryComponent>& component) {
-	(void)component; // stub - does nothing
+	if (!component || component.get() == this || selection) return;
+
+	if (!ownsChildren) {
+		const bool present = std::any_of(referencedComponents.begin(), referencedComponents.end(),
+			[&](const std::weak_ptr<InventoryComponent>& entry) { return entry.lock() == component; });
+		if (!present) {
+			referencedComponents.push_back(component);
+			touchTopology();
+		}
+		return;
+	}
+
+	// Owning an ancestor would close a cycle in the ownership tree.
+	const ComponentTree& tree = ComponentTree::shared();
+	for (auto node = tree.parent(treeNode()); node != ComponentTree::kNull; node = tree.parent(node)) {
+		if (node == component->treeNode()) return;
+	}
+
+	// Auto-move: detach from the previous owner first (see HEADER_GUIDE.md).
+	auto previousOwner = component->getOwner();
+	if (previousOwner.get() == this) return;
+	if (previousOwner) previousOwner->remove(component);
+
+	ownedComponents.push_back(component);
+	auto subgroup = dynamic_cast<const Group*>(component.get());
+	if (subgroup && subgroup->ownsChildren) ownedGroups.push_back(subgroup);
+	component->setOwner(shared_from_this());
+	touchTopology();
+
+	const Contribution added = contributionOf(*component);
+	propagate(added.priceCents, added.plantCount);
 }
 
 void Group::remove(const std::shared_ptr<InventoryComponent>& component) {
-	(void)component; // stub - does nothing
+	if (!component) return;
+
+	auto owned = std::find(ownedComponents.begin(), ownedComponents.end(), component);
+	if (owned != ownedComponents.end()) {
+		const Contribution removed = contributionOf(*component);
+		propagate(-removed.priceCents, -removed.plantCount);
+		component->setOwner(nullptr);
+		ownedComponents.erase(owned);
+		ownedGroups.erase(std::remove(ownedGroups.begin(), ownedGroups.end(), component.get()), ownedGroups.end());
+		touchTopology();
+		return;
+	}
+
+	auto referenced = std::find_if(referencedComponents.begin(), referencedComponents.end(),
+		[&](const std::weak_ptr<InventoryComponent>& entry) { return entry.lock() == component; });
+	if (referenced != referencedComponents.end()) {
+		referencedComponents.erase(referenced);
+		touchTopology();
+	}
+}
+
+std::size_t Group::moveAll(const std::shared_ptr<Group>& destination, const Filter& filter) {
+	if (!destination || destination.get() == this || !ownsChildren || !destination->ownsChildren) return 0;
+
+	// A child that is 'destination' or one of its ancestors cannot move under it.
+	ComponentTree& tree = ComponentTree::shared();
+	std::vector<ComponentTree::Handle> destinationPath;
+	for (auto node = destination->treeNode(); node != ComponentTree::kNull; node = tree.parent(node)) {
+		destinationPath.push_back(node);
+	}
+	auto movable = [&](const InventoryComponent& child) {
+		return std::find(destinationPath.begin(), destinationPath.end(), child.treeNode()) == destinationPath.end()
+			&& (!filter || filter(child));
+	};
+
+	// Indexes and views only care which inventory a plant is in: moving between two
+	// inventories leaves one and enters the other once, for all moved children together.
+	Inventory* const from = Inventory::holding(*this);
+	Inventory* const to = Inventory::holding(*destination);
+	std::vector<InventoryComponent*> crossing;
+	Contribution moved{0, 0};
+	std::size_t count = 0;
+	std::size_t kept = 0;
+	for (std::size_t index = 0; index < ownedComponents.size(); ++index) {
+		auto& child = ownedComponents[index];
+		if (!movable(*child)) {
+			if (kept != index) ownedComponents[kept] = std::move(child);
+			++kept;
+			continue;
+		}
+		const Contribution contribution = contributionOf(*child);
+		moved.priceCents += contribution.priceCents;
+		moved.plantCount += contribution.plantCount;
+		tree.appendChild(destination->treeNode(), child->treeNode());
+		if (from != to) crossing.push_back(child.get());
+		auto subgroup = dynamic_cast<const Group*>(child.get());
+		if (subgroup && subgroup->ownsChildren) {
+			ownedGroups.erase(std::find(ownedGroups.begin(), ownedGroups.end(), subgroup));
+			destination->ownedGroups.push_back(subgroup);
+		}
+		destination->ownedComponents.push_back(std::move(child));
+		++count;
+	}
+	ownedComponents.resize(kept);
+	if (count == 0) return 0;
+	if (from) from->untrack(crossing.data(), crossing.size());
+	if (to) to->track(crossing.data(), crossing.size());
+
+	propagate(-moved.priceCents, -moved.plantCount);
+	destination->propagate(moved.priceCents, moved.plantCount);
+	touchTopology();
+	return count;
 }
 
 std::vector<std::shared_ptr<InventoryComponent>> Group::members() const {
-	return {};
+	if (ownsChildren) return ownedComponents;
+	std::vector<std::shared_ptr<InventoryComponent>> alive;
+	if (selection) {
+		alive.reserve(selectedPlants().size());
+		for (InventoryComponent* plant : selectedPlants()) {
+			if (auto member = sharedPlant(plant)) alive.push_back(std::move(member));
+		}
+		return alive;
+	}
+	alive.reserve(referencedComponents.size());
+	for (const auto& entry : referencedComponents) {
+		if (auto component = entry.lock()) alive.push_back(std::move(component));
+	}
+	return alive;
+}
+
+void Group::pruneExpiredReferences() {
+	referencedComponents.erase(std::remove_if(referencedComponents.begin(), referencedComponents.end(),
+		[](const std::weak_ptr<InventoryComponent>& entry) { return entry.expired(); }), referencedComponents.end());
 }
 
-void Group::pruneExpiredReferences() { }
+const std::vector<InventoryComponent*>& Group::selectedPlants() const {
+	static const std::vector<InventoryComponent*> none;
+	if (!selection) return none;
+	applyNotedChanges();
+	return selection->plants;
+}
+
+std::size_t Group::memberSlots() const {
+	if (ownsChildren) return ownedComponents.size();
+	if (selection) return selectedPlants().size();
+	return referencedComponents.size();
+}
+
+InventoryComponent* Group::memberSlot(std::size_t index) const {
+	if (ownsChildren) return ownedComponents[index].get();
+	if (selection) return selection->plants[index];
+	// The referenced component stays alive through its owner, not through this lock.
+	return referencedComponents[index].lock().get();
+}
 
+bool Group::hasMember(const InventoryComponent& component) const {
+	if (selection) {
+		applyNotedChanges();
+		return selection->positions.count(&component) != 0;
+	}
+	bool found = false;
+	forEachMember([&](const InventoryComponent& member) { found = found || &member == &component; });
+	return found;
+}
+
+std::size_t Group::memberCount() const {
+	if (ownsChildren) return ownedComponents.size();
+	if (selection) return selectedPlants().size();
+	std::size_t count = 0;
+	forEachMember([&count](const InventoryComponent&) { ++count; });
+	return count;
+}
+
+void Group::refreshView() {
+	if (!selection) return;
+	{
+		std::lock_guard<std::mutex> lock(selection->notedMutex);
+		selection->noted.clear();
+	}
+	selection->plants.clear();
+	selection->positions.clear();
+	if (!selection->scope) return;
+	const ComponentTree& tree = ComponentTree::shared();
+	for (const auto& root : selection->scope->getComponents()) {
+		tree.forEachPreOrder(root->treeNode(), [&](ComponentTree::Handle node) {
+			InventoryComponent* component = tree.component(node);
+			if (dynamic_cast<Plant*>(component)) selection->evaluate(component);
+		});
+	}
+}
+
+void Group::select(InventoryComponent& plant) {
+	applyNotedChanges();
+	selection->evaluate(&plant);
+}
+
+void Group::deselect(const InventoryComponent& plant) {
+	applyNotedChanges();
+	selection->erase(&plant);
+}
+
+void Group::noteChanged(InventoryComponent& plant) {
+	std::lock_guard<std::mutex> lock(selection->notedMutex);
+	selection->noted.push_back(&plant);
+}
+
+void Group::applyNotedChanges() const { selection->applyNoted(); }
+
+void Group::bind(Inventory* scope) {
+	if (scope && !selection->scope) Inventory::registeredViews.fetch_add(1, std::memory_order_relaxed);
+	if (!scope && selection->scope) Inventory::registeredViews.fetch_sub(1, std::memory_order_relaxed);
+	selection->scope = scope;
+	refreshView();
+}
@@ -1,17 +1,78 @@
 #include "../../include/Components/InventoryComponent.h"
 #include "../../include/Components/Group.h"
+#include "../../include/Components/TypeRegistry.h"
+#include "../../include/Core/Inventory.h"
 
 #include <atomic>
+#include <stdexcept>
+#include <string>
 
-// Define and initialize the static nextId counter
-std::atomic<uint64_t> InventoryComponent::nextId{0};
+// Define and initialize the static nextId counter (ids start at 1; 0 means "none")
+std::atomic<uint64_t> InventoryComponent::nextId{1};
+std::atomic<uint64_t> InventoryComponent::topologyEpoch{0};
 
-InventoryComponent::InventoryComponent() {
-    // Assign a unique id at construction time
-    id_ = ++nextId;
+namespace {
+
+// This thread's claimed id block: ids [nextLocalId, localIdEnd) are still free.
+thread_local uint64_t nextLocalId = 0;
+thread_local uint64_t localIdEnd = 0;
+
+} // namespace
+
+InventoryComponent::InventoryComponent() : node_(ComponentTree::shared().allocate(this)) {
+    // Assign a unique id at construction time, touching the shared counter once per block
+    if (nextLocalId == localIdEnd) {
+        nextLocalId = nextId.fetch_add(ComponentRegistry::kIdBlock, std::memory_order_relaxed);
+        localIdEnd = nextLocalId + ComponentRegistry::kIdBlock;
+    }
+    id_ = nextLocalId++;
+    ComponentRegistry::shared().insert(id_, this);
+}
+
+InventoryComponent::InventoryComponent(const InventoryComponent& other)
+    : id_(other.id_), kind_(other.kind_), node_(ComponentTree::shared().allocate(this)) {
+    // Indexed only if the original is gone; otherwise find() keeps returning the original.
+    ComponentRegistry::shared().insert(id_, this);
+}
+
+InventoryComponent& InventoryComponent::operator=(const InventoryComponent& other) {
+    shareId(other.id_);
+    return *this;
+}
+
+InventoryComponent::~InventoryComponent() {
+    ComponentRegistry::shared().erase(id_, this);
+    ComponentTree::shared().release(node_);
+}
+
+void InventoryComponent::setId(uint64_t id) {
+    if (id == id_) return;
+    const InventoryComponent* holder = ComponentRegistry::shared().find(id);
+    if (holder && holder != this) {
+        // Taking the id would leave one of the two unresolvable once the other is destroyed.
+        throw std::invalid_argument("InventoryComponent::setId: id " + std::to_string(id) + " is in use");
+    }
+    shareId(id);
+}
+
+void InventoryComponent::shareId(uint64_t id) {
+    if (id == id_) return;
+    ComponentRegistry& registry = ComponentRegistry::shared();
+    registry.erase(id_, this);
+    id_ = id;
+    registry.insert(id_, this);
+    markChanged();
+}
+
+uint64_t InventoryComponent::reserveIds(uint64_t count) {
+    // Whole blocks, so fresh ids keep starting at block boundaries.
+    const uint64_t blocks = (count + ComponentRegistry::kIdBlock - 1) / ComponentRegistry::kIdBlock;
+    return nextId.fetch_add(blocks * ComponentRegistry::kIdBlock, std::memory_order_relaxed);
 }
 
-InventoryComponent::~InventoryComponent() = default;
+ComponentTypeId InventoryComponent::typeId() const { return TypeRegistry::shared().idOf(*this); }
+
+void InventoryComponent::markChanged() noexcept { ComponentTree::shared().markChanged(node_); }
 
 void InventoryComponent::add(const std::shared_ptr<InventoryComponent>& component) {
     // Default: do nothing. Composite classes override this.
@@ -24,9 +85,20 @@ void InventoryComponent::remove(const std::shared_ptr<InventoryComponent>& compo
 }
 
 std::shared_ptr<Group> InventoryComponent::getOwner() const {
-    return owner_.lock();
+    const ComponentTree& tree = ComponentTree::shared();
+    const ComponentTree::Handle parent = tree.parent(node_);
+    if (parent == ComponentTree::kNull) return nullptr;
+    // Only owning Groups link children; an owner mid-destruction reports none.
+    return static_cast<Group*>(tree.component(parent))->weak_from_this().lock();
 }
 
 void InventoryComponent::setOwner(const std::shared_ptr<Group>& owner) {
-    owner_ = owner;
+    ComponentTree& tree = ComponentTree::shared();
+    if (tree.parent(node_) != ComponentTree::kNull) Inventory::leaving(*this);
+    if (owner) {
+        tree.appendChild(owner->treeNode(), node_);
+        Inventory::placed(*this);
+    } else {
+        tree.detach(node_);
+    }
 }
@@ -1,35 +1,162 @@
 #include "../../include/Components/Plant.h"
+#include "../../include/Components/Group.h"
 #include "../../include/Patterns/State/PlantState.h"
-#include "../../include/Patterns/Iterator/Iterator.h"
+#include "../../include/Patterns/Iterator/CompositeIterator.h"
+#include "../../include/Patterns/Iterator/PreOrderTraversal.h"
+#include "../../include/Patterns/Observer/Observer.h"
+#include "../../include/Core/Json.h"
+#include "../../include/Core/Inventory.h"
 
-Plant::Plant(const std::string& name, double price)
-	: name(name), price(price), age(0), health(100), waterLevel(100), currentState(nullptr) {}
+#include <algorithm>
+#include <charconv>
 
-std::string Plant::getName() const { return name; }
+std::atomic<uint64_t> Plant::nextStockSequence{1};
 
-double Plant::getPrice() const { return price; }
+Plant::Plant(Symbol name, double price, int thirst, std::shared_ptr<PlantStore> store)
+	: name(name), price(price), store(store ? std::move(store) : PlantStore::shared()), slot(0) {
+	slot = this->store->allocate(this, thirst);
+}
 
-std::unique_ptr<Iterator> Plant::createIterator() { return nullptr; }
+Plant::~Plant() { store->release(slot); }
+
+std::unique_ptr<Iterator> Plant::createIterator() {
+	// Aliasing constructor: shares ownership with the Subject base's control block.
+	std::shared_ptr<InventoryComponent> self(shared_from_this(), this);
+	return std::make_unique<CompositeIterator>(self, std::make_unique<PreOrderTraversal>());
+}
 
 std::shared_ptr<InventoryComponent> Plant::clone() const { return nullptr; }
 
 std::shared_ptr<InventoryComponent> Plant::blueprintClone() const { return nullptr; }
 
-std::string Plant::serialize() const { return std::string(); }
-
-void Plant::deserialize(const std::string& data) { (void)data; }
-
-std::string Plant::typeName() const { return "Plant"; }
-
-void Plant::setState(std::unique_ptr<PlantState> state) { currentState = std::move(state); }
-
-void Plant::performDailyActivity() { if (currentState) currentState->performDailyActivity(this); }
-
-void Plant::attach(const std::shared_ptr<Observer>& observer) { (void)observer; }
-
-void Plant::detach(const std::shared_ptr<Observer>& observer) { (void)observer; }
-
-void Plant::notify() { /* stub */ }
+std::string Plant::serialize() const {
+	std::string out = "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId());
+	out += ",\"data\":{\"name\":" + Json::quote(name.view()) + ",\"price\":" + Json::number(price);
+	out += ",\"age\":" + std::to_string(getAge()) + ",\"health\":" + std::to_string(getHealth());
+	out += ",\"water\":" + std::to_string(getWaterLevel());
+	out += ",\"stage\":" + std::to_string(static_cast<int>(getStage())) + "}}";
+	return out;
+}
+
+void Plant::deserialize(const std::string& data) {
+	// 'data' is the whole record (TypeRegistry::instantiate()); name and price were read by the
+	// constructor. A field missing from an older record keeps the fresh plant's value.
+	const std::string_view fields = Json::field(data, "data");
+	auto read = [fields](std::string_view key, int& value) {
+		const std::string_view text = Json::field(fields, key);
+		return !text.empty() && std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+	};
+	int value = 0;
+	if (read("age", value)) setAge(value);
+	if (read("health", value)) setHealth(value);
+	if (read("water", value)) setWaterLevel(value);
+	if (read("stage", value) && value >= 0 && value < static_cast<int>(kLifecycleStageCount)) {
+		setStage(static_cast<LifecycleStage>(value));
+	}
+}
+
+std::string_view Plant::typeNameView() const { return "Plant"; }
+
+void Plant::setState(const PlantState& state) { setStage(state.stage()); }
+
+const PlantState& Plant::getState() const { return PlantState::forStage(getStage()); }
+
+LifecycleStage Plant::getStage() const noexcept { return store->stage(slot); }
+
+void Plant::setStage(LifecycleStage stage) noexcept {
+	store->assignStage(slot, stage);
+	markChanged();
+	Group::plantStateChanged(*this);
+}
+
+void Plant::performDailyActivity() {
+	const LifecycleStage stageBefore = getStage();
+	const int waterBefore = getWaterLevel();
+	getState().performDailyActivity(this);
+
+	const bool becameThirsty = waterBefore >= LifecycleRules::kThirstyThreshold
+		&& getWaterLevel() < LifecycleRules::kThirstyThreshold;
+	if (becameThirsty || getStage() != stageBefore) notify();
+}
+
+void Plant::attach(const std::shared_ptr<Observer>& observer) {
+	if (observer) observers.push_back(observer);
+}
+
+void Plant::detach(const std::shared_ptr<Observer>& observer) {
+	observers.erase(std::remove_if(observers.begin(), observers.end(),
+		[&](const std::weak_ptr<Observer>& entry) {
+			auto alive = entry.lock();
+			return !alive || alive == observer;
+		}), observers.end());
+}
+
+void Plant::notify() {
+	Inventory::stateChanged(*this);
+	notifyObservers();
+}
+
+void Plant::notifyObservers() {
+	if (observers.empty()) return;
+	// Copy live observers first so update() may attach/detach safely.
+	std::vector<std::shared_ptr<Observer>> alive;
+	alive.reserve(observers.size());
+	for (const auto& entry : observers) {
+		if (auto observer = entry.lock()) alive.push_back(std::move(observer));
+	}
+	if (alive.size() != observers.size()) {
+		observers.erase(std::remove_if(observers.begin(), observers.end(),
+			[](const std::weak_ptr<Observer>& entry) { return entry.expired(); }), observers.end());
+	}
+	const auto self = shared_from_this();
+	for (const auto& observer : alive) observer->update(self);
+}
 
 void Plant::detachAllObservers() { observers.clear(); }
 
+int Plant::getAge() const noexcept { return store->age(slot); }
+
+int Plant::getHealth() const noexcept { return store->health(slot); }
+
+int Plant::getWaterLevel() const noexcept { return store->waterLevel(slot); }
+
+int Plant::getThirst() const noexcept { return store->thirst(slot); }
+
+void Plant::setAge(int value) noexcept {
+	store->assignAge(slot, value);
+	markChanged();
+	Group::plantStateChanged(*this);
+}
+
+void Plant::setHealth(int value) noexcept {
+	store->assignHealth(slot, value);
+	markChanged();
+	Group::plantStateChanged(*this);
+}
+
+void Plant::setWaterLevel(int value) noexcept {
+	store->assignWaterLevel(slot, value);
+	markChanged();
+	Group::plantStateChanged(*this);
+}
+
+std::shared_ptr<Plant> Plant::resolve(uint64_t id) {
+	auto* plant = dynamic_cast<Plant*>(findById(id));
+	if (!plant) return nullptr;
+	// Share ownership with whoever holds the plant; one not held by a shared_ptr resolves to nothing.
+	auto holder = plant->Subject::weak_from_this().lock();
+	return holder ? std::shared_ptr<Plant>(holder, plant) : nullptr;
+}
+
+uint64_t Plant::markStocked() noexcept {
+	if (stockSequence == 0) stockSequence = nextStockSequence.fetch_add(1, std::memory_order_relaxed);
+	return stockSequence;
+}
+
+void Plant::copyRuntimeStateFrom(const Plant& other) {
+	shareId(other.getId());
+	setAge(other.getAge());
+	setHealth(other.getHealth());
+	setWaterLevel(other.getWaterLevel());
+	setStage(other.getStage());
+}
@@ -0,0 +1,320 @@
+#include "../../include/Components/PlantStore.h"
+#include "../../include/Components/ComponentTree.h"
+
+#include <algorithm>
+#include <limits>
+
+const std::shared_ptr<PlantStore>& PlantStore::shared() {
+	static const std::shared_ptr<PlantStore> store = std::make_shared<PlantStore>();
+	return store;
+}
+
+const std::shared_ptr<PlantStore>& PlantStore::archive() {
+	static const std::shared_ptr<PlantStore> store = std::make_shared<PlantStore>();
+	return store;
+}
+
+uint64_t PlantStore::stateVersion() noexcept {
+	if (stateDirty.load(std::memory_order_relaxed) && stateDirty.exchange(false, std::memory_order_acq_rel)) {
+		stateEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+	return stateEpoch.load(std::memory_order_relaxed);
+}
+
+PlantStore::Slot PlantStore::allocate(Plant* view, int32_t thirst) {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	Slot slot;
+	if (!freeSlots.empty()) {
+		slot = freeSlots.back();
+		freeSlots.pop_back();
+	} else {
+		slot = static_cast<Slot>(stages.size());
+		ages.push_back(0);
+		healths.push_back(0);
+		waterLevels.push_back(0);
+		thirsts.push_back(0);
+		stages.push_back(kFreeSlot);
+		eventFlags.push_back(NoEvent);
+		views.push_back(nullptr);
+		quietThrough.push_back(kQuietUnknown);
+		quietExact.push_back(0);
+		syncedDays.push_back(kNotDeferred);
+		watchedFlags.push_back(0);
+	}
+	ages[slot] = 0;
+	healths[slot] = LifecycleRules::kMaxLevel;
+	waterLevels[slot] = LifecycleRules::kMaxLevel;
+	thirsts[slot] = thirst;
+	stages[slot] = static_cast<uint8_t>(LifecycleStage::Seedling);
+	eventFlags[slot] = NoEvent;
+	views[slot] = view;
+	quietThrough[slot] = kQuietUnknown;
+	quietExact[slot] = 0;
+	syncedDays[slot] = kNotDeferred;
+	watchedFlags[slot] = 0;
+	return slot;
+}
+
+void PlantStore::release(Slot slot) {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	stages[slot] = kFreeSlot;
+	eventFlags[slot] = NoEvent;
+	views[slot] = nullptr;
+	syncedDays[slot] = kNotDeferred;
+	watchedFlags[slot] = 0;
+	freeSlots.push_back(slot);
+}
+
+void PlantStore::reserve(std::size_t count) {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	if (count <= freeSlots.size()) return;
+	const std::size_t slots = stages.size() + (count - freeSlots.size());
+	ages.reserve(slots);
+	healths.reserve(slots);
+	waterLevels.reserve(slots);
+	thirsts.reserve(slots);
+	stages.reserve(slots);
+	eventFlags.reserve(slots);
+	views.reserve(slots);
+	quietThrough.reserve(slots);
+	quietExact.reserve(slots);
+	syncedDays.reserve(slots);
+	watchedFlags.reserve(slots);
+}
+
+std::size_t PlantStore::size() const {
+	std::lock_guard<std::mutex> lock(allocationMutex);
+	return stages.size() - freeSlots.size();
+}
+
+void PlantStore::tick(int32_t extraWaterLoss, LifecycleCounters* counters) {
+	tickRange(0, static_cast<Slot>(stages.size()), extraWaterLoss, counters);
+}
+
+void PlantStore::tickRange(Slot begin, Slot end, int32_t extraWaterLoss, LifecycleCounters* counters,
+	RangeState* state) {
+	end = std::min<Slot>(end, static_cast<Slot>(stages.size()));
+	if (begin >= end) return;
+	if (!state) markStateChanged();
+	// Every plant of the range may have changed; snapshots re-check them all.
+	ComponentTree::shared().markAllChanged();
+	std::fill(eventFlags.begin() + begin, eventFlags.begin() + end, static_cast<uint8_t>(NoEvent));
+	// Withered plants are inert, so only the living stages get a pass.
+	tickStage(LifecycleStage::Seedling, begin, end, extraWaterLoss);
+	tickStage(LifecycleStage::Growing, begin, end, extraWaterLoss);
+	tickStage(LifecycleStage::Mature, begin, end, extraWaterLoss);
+	tickStage(LifecycleStage::Withering, begin, end, extraWaterLoss);
+	applyTransitions(begin, end, counters);
+	if (state) summarize(begin, end, *state);
+}
+
+void PlantStore::summarize(Slot begin, Slot end, RangeState& state) const noexcept {
+	end = std::min<Slot>(end, static_cast<Slot>(stages.size()));
+	int32_t minHealth = state.minHealth;
+	int32_t minWater = state.minWaterLevel;
+	for (Slot slot = begin; slot < end; ++slot) {
+		if (stages[slot] >= kLifecycleStageCount) continue; // free slot
+		++state.stageCounts[stages[slot]];
+		minHealth = std::min(minHealth, healths[slot]);
+		minWater = std::min(minWater, waterLevels[slot]);
+	}
+	state.minHealth = minHealth;
+	state.minWaterLevel = minWater;
+}
+
+namespace {
+
+// Kept as a free function so the __restrict qualifiers apply and GCC vectorizes
+// the loop without run-time alias checks across the six columns.
+void tickStageKernel(uint8_t tag, StageRule stageRule, int32_t extraWaterLoss, std::size_t count,
+	const uint8_t* __restrict stageTags, const int32_t* __restrict thirst,
+	int32_t* __restrict age, int32_t* __restrict health, int32_t* __restrict water,
+	uint8_t* __restrict event) {
+	using namespace LifecycleRules;
+	// Branch-free: slots in other stages get a zero mask and keep their values.
+	for (std::size_t i = 0; i < count; ++i) {
+		const int32_t inStage = stageTags[i] == tag;
+		const int32_t oldWater = water[i];
+		int32_t newWater = oldWater - inStage * (stageRule.waterUse + thirst[i] + extraWaterLoss);
+		newWater = newWater < 0 ? 0 : newWater;
+		const int32_t delta = newWater < kDryThreshold ? -stageRule.dryDamage : stageRule.recovery;
+		int32_t newHealth = health[i] + inStage * delta;
+		newHealth = newHealth < 0 ? 0 : (newHealth > kMaxLevel ? kMaxLevel : newHealth);
+
+		age[i] += inStage;
+		water[i] = newWater;
+		health[i] = newHealth;
+		event[i] |= static_cast<uint8_t>(inStage & (oldWater >= kThirstyThreshold) & (newWater < kThirstyThreshold));
+	}
+}
+
+} // namespace
+
+void PlantStore::tickStage(LifecycleStage stage, Slot begin, Slot end, int32_t extraWaterLoss) {
+	tickStageKernel(static_cast<uint8_t>(stage), LifecycleRules::rule(stage), extraWaterLoss, end - begin,
+		stages.data() + begin, thirsts.data() + begin, ages.data() + begin,
+		healths.data() + begin, waterLevels.data() + begin, eventFlags.data() + begin);
+}
+
+void PlantStore::applyTransitions(Slot begin, Slot end, LifecycleCounters* counters) {
+	LifecycleEngine::advance(end - begin, stages.data() + begin, ages.data() + begin, healths.data() + begin,
+		eventFlags.data() + begin, StageChanged, counters);
+}
+
+namespace {
+
+using LifecycleRules::kMaxLevel;
+
+constexpr int64_t kNever = std::numeric_limits<int64_t>::max() / 4;
+
+// Inclusive range of day offsets (day 1 is tomorrow); empty when lo > hi.
+struct DayRange {
+	int64_t lo;
+	int64_t hi;
+
+	DayRange& operator&=(const DayRange& other) noexcept {
+		lo = std::max(lo, other.lo);
+		hi = std::min(hi, other.hi);
+		return *this;
+	}
+	bool empty() const noexcept { return lo > hi; }
+	DayRange shifted(int64_t offset) const noexcept {
+		return {lo <= -kNever ? lo : lo + offset, hi >= kNever ? hi : hi + offset};
+	}
+};
+
+int64_t floorDiv(int64_t n, int64_t d) { return n >= 0 ? n / d : -((-n + d - 1) / d); }
+int64_t ceilDiv(int64_t n, int64_t d) { return -floorDiv(-n, d); }
+
+// Extra water lost over the first 'days' days of a weather prefix that need not start at zero.
+int64_t weatherOver(const int32_t* weatherPrefix, int64_t days) {
+	return static_cast<int64_t>(weatherPrefix[days]) - weatherPrefix[0];
+}
+
+// First day k in [1, days] on which 'water - k * use - weatherOver(weatherPrefix, k)' is below 'threshold',
+// or days + 1. Water never rises between waterings, so the expression is non-increasing in k.
+int64_t firstDayBelow(int64_t water, int64_t use, const int32_t* weatherPrefix, int64_t days, int64_t threshold) {
+	int64_t lo = 1;
+	int64_t hi = days + 1;
+	while (lo < hi) {
+		const int64_t mid = lo + (hi - lo) / 2;
+		if (water - mid * use - weatherOver(weatherPrefix, mid) < threshold) hi = mid;
+		else lo = mid + 1;
+	}
+	return lo;
+}
+
+// Days k >= 1 on which health min(kMaxLevel, start + k * rate) lies in [minHealth, maxHealth].
+DayRange risingHealthDays(int64_t start, int64_t rate, int64_t minHealth, int64_t maxHealth) {
+	DayRange days{-kNever, kNever};
+	if (minHealth > kMaxLevel) days.lo = kNever;
+	else if (start < minHealth) days.lo = rate > 0 ? ceilDiv(minHealth - start, rate) : kNever;
+	if (maxHealth < kMaxLevel) days.hi = rate > 0 ? floorDiv(maxHealth - start, rate) : (start <= maxHealth ? kNever : -kNever);
+	return days;
+}
+
+// Days m >= 1 on which health max(0, start - m * rate) lies in [minHealth, maxHealth].
+DayRange fallingHealthDays(int64_t start, int64_t rate, int64_t minHealth, int64_t maxHealth) {
+	DayRange days{-kNever, kNever};
+	if (minHealth > 0) days.hi = rate > 0 ? floorDiv(start - minHealth, rate) : (start >= minHealth ? kNever : -kNever);
+	if (start > maxHealth) days.lo = rate > 0 ? ceilDiv(start - maxHealth, rate) : kNever;
+	return days;
+}
+
+/**
+ * Days before the first event of one living slot, capped at 'days'.
+ *
+ * Until the soil turns dry on day 'dry' health only rises, and from then on it
+ * only falls, so within each of the two phases age and health are both monotone
+ * and the days a transition row matches form one interval.
+ */
+int64_t slotQuietDays(LifecycleStage stage, int64_t age, int64_t health, int64_t water, int64_t use,
+	const int32_t* weatherPrefix, int64_t days) {
+	using namespace LifecycleRules;
+	// Water at the end of the horizon tells whether a threshold is crossed at all; most slots never search.
+	const int64_t waterAtEnd = water - days * use - weatherOver(weatherPrefix, days);
+	if (water >= kThirstyThreshold && waterAtEnd < kThirstyThreshold) {
+		days = firstDayBelow(water, use, weatherPrefix, days, kThirstyThreshold) - 1;
+		if (days == 0) return 0;
+	}
+
+	const StageRule& stageRule = rule(stage);
+	const int64_t dry = waterAtEnd >= kDryThreshold ? days + 1 : firstDayBelow(water, use, weatherPrefix, days, kDryThreshold);
+	const int64_t healthAtDry = std::min<int64_t>(kMaxLevel, health + (dry - 1) * stageRule.recovery);
+	int64_t firstEvent = days + 1;
+	for (const TransitionRule& row : kTransitions) {
+		if (row.from != stage) continue;
+		const DayRange ages{row.minAge - age, row.maxAge - age};
+		DayRange rising{1, std::min(days, dry - 1)};
+		rising &= ages;
+		rising &= risingHealthDays(health, stageRule.recovery, row.minHealth, row.maxHealth);
+		if (!rising.empty()) firstEvent = std::min(firstEvent, rising.lo);
+		DayRange falling{dry, days};
+		falling &= ages;
+		falling &= fallingHealthDays(healthAtDry, stageRule.dryDamage, row.minHealth, row.maxHealth).shifted(dry - 1);
+		if (!falling.empty()) firstEvent = std::min(firstEvent, falling.lo);
+	}
+	return firstEvent - 1;
+}
+
+} // namespace
+
+uint32_t PlantStore::quietDays(Slot begin, Slot end, uint32_t today, const int32_t* weatherPrefix, uint32_t days) {
+	end = std::min<Slot>(end, static_cast<Slot>(stages.size()));
+	uint32_t quiet = days;
+	for (Slot slot = begin; slot < end && quiet > 0; ++slot) {
+		// Withered plants are inert and free slots are never ticked.
+		if (stages[slot] >= static_cast<uint8_t>(LifecycleStage::Withered)) continue;
+		const uint32_t known = quietThrough[slot];
+		if (known != kQuietUnknown && known >= today && (quietExact[slot] || known - today >= quiet)) {
+			quiet = std::min(quiet, known - today);
+			continue;
+		}
+
+		const auto stage = static_cast<LifecycleStage>(stages[slot]);
+		const int64_t use = LifecycleRules::rule(stage).waterUse + thirsts[slot];
+		// Out-of-range values are clamped by the first real tick; let it run.
+		if (healths[slot] < 0 || healths[slot] > kMaxLevel || use < 0) return 0;
+		// Solve over the whole horizon (not just 'quiet') so the cached answer serves later calls too.
+		const auto solved = static_cast<uint32_t>(
+			slotQuietDays(stage, ages[slot], healths[slot], waterLevels[slot], use, weatherPrefix, days));
+		quietThrough[slot] = today + solved;
+		quietExact[slot] = solved < days;
+		quiet = std::min(quiet, solved);
+	}
+	return quiet;
+}
+
+void PlantStore::forgetQuietDays(Slot begin, Slot end) {
+	end = std::min<Slot>(end, static_cast<Slot>(stages.size()));
+	if (begin < end) std::fill(quietThrough.begin() + begin, quietThrough.begin() + end, kQuietUnknown);
+}
+
+void PlantStore::fastForward(Slot begin, Slot end, const int32_t* weatherPrefix, uint32_t days,
+	LifecycleCounters* counters, RangeState* state) {
+	end = std::min<Slot>(end, static_cast<Slot>(stages.size()));
+	if (begin >= end) return;
+	if (!state) markStateChanged();
+	// Every plant of the range may have changed; snapshots re-check them all.
+	ComponentTree::shared().markAllChanged();
+	std::fill(eventFlags.begin() + begin, eventFlags.begin() + end, static_cast<uint8_t>(NoEvent));
+	const int64_t span = days;
+	for (Slot slot = begin; slot < end; ++slot) {
+		if (counters && stages[slot] < kLifecycleStageCount) ++counters->population[stages[slot]];
+		if (stages[slot] >= static_cast<uint8_t>(LifecycleStage::Withered) || span == 0) continue;
+		const StageRule& stageRule = LifecycleRules::rule(static_cast<LifecycleStage>(stages[slot]));
+		const int64_t use = stageRule.waterUse + thirsts[slot];
+		const int64_t water = waterLevels[slot];
+		// Same two phases as slotQuietDays(): recovery until the soil is dry, damage afterwards.
+		const int64_t waterAtEnd = water - span * use - weatherOver(weatherPrefix, span);
+		const int64_t dry = waterAtEnd >= LifecycleRules::kDryThreshold
+			? span + 1 : firstDayBelow(water, use, weatherPrefix, span, LifecycleRules::kDryThreshold);
+		int64_t health = std::min<int64_t>(kMaxLevel, healths[slot] + std::min(span, dry - 1) * stageRule.recovery);
+		if (span >= dry) health = std::max<int64_t>(0, health - (span - dry + 1) * stageRule.dryDamage);
+
+		ages[slot] += static_cast<int32_t>(span);
+		waterLevels[slot] = static_cast<int32_t>(std::max<int64_t>(0, waterAtEnd));
+		healths[slot] = static_cast<int32_t>(health);
+	}
+	if (state) summarize(begin, end, *state);
+}
@@ -0,0 +1,43 @@
+#include "../../include/Components/Rose.h"
+
+#include <algorithm>
+
+namespace {
+constexpr int kRoseThirst = 4;     // water lost per day on top of the stage rule
+constexpr int kRoseWaterDose = 40; // water added by one watering
+}
+
+Rose::Rose(Symbol name, double price, std::shared_ptr<PlantStore> store)
+	: Plant(name, price, kRoseThirst, std::move(store)) {
+	kind_ = ComponentKind::Rose;
+}
+
+void Rose::water() {
+	if (getStage() == LifecycleStage::Withered) return;
+	setWaterLevel(std::min(LifecycleRules::kMaxLevel, getWaterLevel() + kRoseWaterDose));
+}
+
+void Rose::waterAll(Rose* const* roses, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) roses[i]->Rose::water();
+}
+
+WaterLevel Rose::getWaterRequirement() const { return HIGH; }
+
+SunLevel Rose::getSunRequirement() const { return PARTIAL; }
+
+std::shared_ptr<InventoryComponent> Rose::clone() const {
+	// Snapshot copies live in the archive store so the daily tick never advances them.
+	auto copy = std::make_shared<Rose>(getNameSymbol(), getPrice(), PlantStore::archive());
+	copy->copyRuntimeStateFrom(*this);
+	return copy;
+}
+
+std::shared_ptr<InventoryComponent> Rose::blueprintClone() const {
+	return std::make_shared<Rose>(getNameSymbol(), getPrice(), getStore());
+}
+
+std::string Rose::serialize() const { return Plant::serialize(); }
+
+void Rose::deserialize(const std::string& data) { Plant::deserialize(data); }
+
+std::string_view Rose::typeNameView() const { return "Rose"; }
@@ -0,0 +1,128 @@
+#include "../../include/Components/TypeRegistry.h"
+#include "../../include/Components/Cactus.h"
+#include "../../include/Components/Group.h"
+#include "../../include/Components/Rose.h"
+#include "../../include/Core/Json.h"
+#include "../../include/Patterns/Decorator/DecoratedItem.h"
+#include "../../include/Patterns/Decorator/GiftWrapDecorator.h"
+#include "../../include/Patterns/Decorator/PotDecorator.h"
+#include "../../include/Patterns/Decorator/RibbonDecorator.h"
+
+#include <charconv>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+std::string_view dataOf(const std::string& record) { return Json::field(record, "data"); }
+
+template <typename PlantType>
+std::shared_ptr<InventoryComponent> createPlant(const std::string& record) {
+	const std::string_view data = dataOf(record);
+	const std::string price(Json::field(data, "price"));
+	return std::make_shared<PlantType>(Json::unquote(Json::field(data, "name")), std::strtod(price.c_str(), nullptr));
+}
+
+std::shared_ptr<InventoryComponent> createGroup(const std::string& record) {
+	const std::string_view data = dataOf(record);
+	return std::make_shared<Group>(Json::unquote(Json::field(data, "name")), Json::field(data, "owns") != "false");
+}
+
+// The component a decorator record wraps under data.wrapped (null for "null").
+std::shared_ptr<InventoryComponent> wrappedOf(const std::string& record) {
+	const std::string_view wrapped = Json::field(dataOf(record), "wrapped");
+	if (wrapped.empty() || wrapped == "null") return nullptr;
+	return TypeRegistry::shared().instantiate(std::string(wrapped));
+}
+
+template <typename DecoratorType>
+std::shared_ptr<InventoryComponent> createDecorator(const std::string& record) {
+	return std::make_shared<DecoratorType>(wrappedOf(record));
+}
+
+std::shared_ptr<InventoryComponent> createDecoratedItem(const std::string& record) {
+	auto item = std::make_shared<DecoratedItem>(wrappedOf(record));
+	// data.addOns is a list of quoted add-on names, innermost first.
+	const std::string_view names = Json::field(dataOf(record), "addOns");
+	for (std::size_t open = names.find('"'); open != std::string_view::npos; open = names.find('"', open)) {
+		const std::size_t close = names.find('"', open + 1);
+		if (close == std::string_view::npos) break;
+		DecoratedItem::AddOn addOn;
+		if (!DecoratedItem::parseAddOn(std::string(names.substr(open + 1, close - open - 1)), addOn)) {
+			throw std::runtime_error("TypeRegistry: unknown add-on in DecoratedItem record");
+		}
+		item->addOn(addOn);
+		open = close + 1;
+	}
+	return item;
+}
+
+} // namespace
+
+TypeRegistry& TypeRegistry::shared() {
+	static TypeRegistry* const registry = new TypeRegistry();
+	return *registry;
+}
+
+TypeRegistry::TypeRegistry() {
+	byKind.fill(kUnregistered);
+	// Save files store these ids: append new built-ins at the end, never reorder.
+	add("Group", ComponentKind::Group, createGroup);
+	add("Rose", ComponentKind::Rose, createPlant<Rose>);
+	add("Cactus", ComponentKind::Cactus, createPlant<Cactus>);
+	add("PotDecorator", ComponentKind::PotDecorator, createDecorator<PotDecorator>);
+	add("RibbonDecorator", ComponentKind::RibbonDecorator, createDecorator<RibbonDecorator>);
+	add("GiftWrapDecorator", ComponentKind::GiftWrapDecorator, createDecorator<GiftWrapDecorator>);
+	add("DecoratedItem", ComponentKind::DecoratedItem, createDecoratedItem);
+}
+
+ComponentTypeId TypeRegistry::add(Symbol name, ComponentKind kind, Create create) {
+	std::lock_guard<std::mutex> lock(registrationMutex);
+	if (byName.count(name)) throw std::invalid_argument("TypeRegistry: type '" + name.str() + "' is already registered");
+	if (kind != ComponentKind::Other && idOf(kind) != kUnregistered) {
+		throw std::invalid_argument("TypeRegistry: another type is registered for the kind of '" + name.str() + "'");
+	}
+	if (types.size() >= kUnregistered) throw std::length_error("TypeRegistry: out of type ids");
+	const auto id = static_cast<ComponentTypeId>(types.size());
+	types.push_back(TypeInfo{name, kind, create});
+	byName.emplace(name, id);
+	if (kind != ComponentKind::Other) byKind[static_cast<std::size_t>(kind)] = id;
+	return id;
+}
+
+ComponentTypeId TypeRegistry::idOf(std::string_view name) const {
+	Symbol symbol;
+	if (!Symbol::lookup(name, symbol)) return kUnregistered;
+	const auto entry = byName.find(symbol);
+	return entry == byName.end() ? kUnregistered : entry->second;
+}
+
+ComponentTypeId TypeRegistry::idOf(const InventoryComponent& component) const {
+	const ComponentTypeId id = idOf(component.kind());
+	return id != kUnregistered ? id : idOf(component.typeNameView());
+}
+
+ComponentTypeId TypeRegistry::typeOfRecord(const std::string& record) const {
+	const std::string_view type = Json::field(record, "type");
+	if (type.empty()) throw std::runtime_error("TypeRegistry: record has no type");
+	ComponentTypeId id = kUnregistered;
+	if (type.front() == '"') {
+		id = idOf(Json::unquote(type));
+	} else {
+		unsigned value = 0;
+		const auto parsed = std::from_chars(type.data(), type.data() + type.size(), value);
+		if (parsed.ec == std::errc() && parsed.ptr == type.data() + type.size() && value < types.size()) {
+			id = static_cast<ComponentTypeId>(value);
+		}
+	}
+	if (id == kUnregistered) throw std::runtime_error("TypeRegistry: unknown type " + std::string(type));
+	return id;
+}
+
+std::shared_ptr<InventoryComponent> TypeRegistry::instantiate(const std::string& record) const {
+	const TypeInfo& type = types[typeOfRecord(record)];
+	if (!type.create) throw std::runtime_error("TypeRegistry: type '" + type.name.str() + "' cannot be loaded");
+	std::shared_ptr<InventoryComponent> component = type.create(record);
+	component->deserialize(record);
+	return component;
+}
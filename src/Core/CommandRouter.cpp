@@ -0,0 +1,101 @@
+#include "../../include/Core/CommandRouter.h"
+#include "../../include/Actors/Staff.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+// std::push_heap/pop_heap build max-heaps; ordering by greater<> keeps the least-loaded member on top.
+using LeastLoaded = std::greater<std::pair<std::size_t, uint32_t>>;
+
+} // namespace
+
+CommandRouter::CommandRouter() = default;
+
+CommandRouter::~CommandRouter() = default;
+
+void CommandRouter::addStaff(const std::shared_ptr<Staff>& staff) {
+	if (!staff) return;
+	const auto index = static_cast<uint32_t>(stats.size());
+	stats.push_back({staff});
+	loadToday.push_back(0);
+	for (std::size_t kind = 0; kind < Command::kKindCount; ++kind) {
+		if (!staff->canHandle(static_cast<Command::Kind>(kind))) continue;
+		pools[kind].members.push_back(index);
+		pools[kind].heap.emplace_back(0, index);
+		std::push_heap(pools[kind].heap.begin(), pools[kind].heap.end(), LeastLoaded());
+	}
+}
+
+void CommandRouter::startDay() {
+	std::fill(loadToday.begin(), loadToday.end(), 0);
+	for (auto& member : stats) {
+		const std::size_t capacity = member.staff->getDailyCapacity();
+		++member.days;
+		if (capacity != Staff::kUnlimited) member.capacityUnits += capacity;
+	}
+	for (auto& pool : pools) {
+		pool.heap.clear();
+		for (uint32_t member : pool.members) pool.heap.emplace_back(0, member);
+		// All loads are zero: sorted by index is already a valid heap for LeastLoaded.
+	}
+}
+
+CommandRouter::Outcome CommandRouter::dispatch(std::unique_ptr<Command>& cmd) {
+	if (!cmd) return Outcome::Dropped;
+	const auto kind = static_cast<std::size_t>(cmd->kind());
+	Pool& pool = pools[kind];
+	if (pool.members.empty()) {
+		cmd->setStatus(Command::Status::Failed);
+		cmd.reset();
+		++kinds[kind].dropped;
+		return Outcome::Dropped;
+	}
+
+	auto& heap = pool.heap;
+	const std::size_t units = cmd->workUnits();
+	// Members with room left, but not for this command: back into the heap once it is placed.
+	skipped.clear();
+	Outcome outcome = Outcome::Deferred;
+	while (!heap.empty()) {
+		std::pop_heap(heap.begin(), heap.end(), LeastLoaded());
+		const uint32_t member = heap.back().second;
+		if (heap.back().first != loadToday[member]) {
+			// Work from another pool raised this member's load: re-file with the real key.
+			heap.back().first = loadToday[member];
+			std::push_heap(heap.begin(), heap.end(), LeastLoaded());
+			continue;
+		}
+		StaffStats& record = stats[member];
+		const std::size_t capacity = record.staff->getDailyCapacity();
+		if (loadToday[member] >= capacity) {
+			heap.pop_back(); // full for the rest of the day
+			continue;
+		}
+		// The command must fit in what is left, unless the member has nothing yet today:
+		// a command larger than a whole day's capacity then still gets done.
+		if (loadToday[member] != 0 && units > capacity - loadToday[member]) {
+			skipped.push_back(heap.back());
+			heap.pop_back();
+			continue;
+		}
+
+		loadToday[member] += units;
+		heap.back().first = loadToday[member];
+		std::push_heap(heap.begin(), heap.end(), LeastLoaded());
+		++record.commands;
+		record.workUnits += units;
+		++kinds[kind].performed;
+		record.staff->perform(std::move(cmd));
+		outcome = Outcome::Performed;
+		break;
+	}
+
+	for (const PoolEntry& entry : skipped) {
+		heap.push_back(entry);
+		std::push_heap(heap.begin(), heap.end(), LeastLoaded());
+	}
+	if (outcome == Outcome::Deferred) ++kinds[kind].deferred;
+	return outcome;
+}
@@ -0,0 +1,226 @@
+#include "../../include/Core/CommandScheduler.h"
+#include "../../include/Patterns/Command/Command.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace {
+
+constexpr uint64_t kSlotMask = CommandScheduler::kWheelSlots - 1;
+
+// Days covered by one slot of 'level'.
+constexpr uint64_t slotSpan(std::size_t level) { return uint64_t{1} << (CommandScheduler::kWheelBits * level); }
+
+} // namespace
+
+void CommandScheduler::QueueWaitStats::record(uint64_t waitNs, uint64_t lateDays) noexcept {
+	++count;
+	totalNs += waitNs;
+	maxNs = std::max(maxNs, waitNs);
+	daysLate += lateDays;
+	std::size_t bucket = 0;
+	while (waitNs >>= 1) ++bucket;
+	++histogram[bucket];
+}
+
+uint64_t CommandScheduler::QueueWaitStats::percentileNs(double q) const noexcept {
+	if (count == 0) return 0;
+	const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+	uint64_t seen = 0;
+	for (std::size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+		seen += histogram[bucket];
+		if (seen >= target) {
+			const uint64_t upper = bucket >= 63 ? ~uint64_t{0} : (uint64_t{2} << bucket) - 1;
+			return std::min(upper, maxNs);
+		}
+	}
+	return maxNs;
+}
+
+CommandScheduler::CommandScheduler() = default;
+
+CommandScheduler::~CommandScheduler() = default;
+
+void CommandScheduler::schedule(std::unique_ptr<Command> cmd, uint64_t dueDay, uint64_t deadline) {
+	if (!cmd) return;
+	const int urgency = cmd->urgency();
+	const uint64_t key = cmd->mergeKey();
+	Mergeable* record = nullptr;
+	if (key != 0) {
+		if (mergeIntoQueued(cmd, key, urgency, dueDay, deadline)) return;
+		record = &mergeable[key];
+		// The key's previous holder (due another day, or refused) is no longer merged into.
+		if (record->command) entryOf(*record).merge = nullptr;
+		*record = {cmd.get(), std::max(dueDay, today), nullptr, 0};
+	}
+	Entry entry{std::move(cmd), urgency, dueDay, deadline, nextSequence++, key, {}, record};
+	if (dueDay <= today) {
+		pushReady(std::move(entry));
+		return;
+	}
+	++deferred;
+	place(std::move(entry));
+}
+
+void CommandScheduler::advanceTo(uint64_t day) {
+	while (today < day) {
+		++today;
+		// Entering a new range of a higher level: bring its entries one level down.
+		if ((today & kSlotMask) == 0) {
+			if (((today >> kWheelBits) & kSlotMask) == 0) {
+				if (((today >> (2 * kWheelBits)) & kSlotMask) == 0) cascade(overflow);
+				cascade(wheel[2][(today >> (2 * kWheelBits)) & kSlotMask]);
+			}
+			cascade(wheel[1][(today >> kWheelBits) & kSlotMask]);
+		}
+		auto& due = wheel[0][today & kSlotMask];
+		for (auto& entry : due) {
+			--deferred;
+			pushReady(std::move(entry));
+		}
+		due.clear();
+	}
+}
+
+std::unique_ptr<Command> CommandScheduler::pop() {
+	if (ready.empty()) return nullptr;
+	Entry entry = std::move(ready.front());
+	if (ready.size() > 1) {
+		settle(std::move(ready.back()), nullptr, 0);
+		ready.pop_back();
+		siftDown(0);
+	} else {
+		ready.pop_back();
+	}
+	if (entry.merge) mergeable.erase(entry.mergeKey);
+
+	const auto waited = std::chrono::steady_clock::now() - entry.readySince;
+	statsFor(entry.command->typeName()).record(
+		static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+		today > entry.deadline ? today - entry.deadline : 0);
+	return std::move(entry.command);
+}
+
+uint64_t CommandScheduler::nextDueDay() const noexcept {
+	uint64_t earliest = std::numeric_limits<uint64_t>::max();
+	if (deferred == 0) return earliest;
+	// Cascading keeps levels only roughly ordered (a level-1 entry can be due before a level-0 one).
+	for (const auto& level : wheel) {
+		for (const auto& slot : level) {
+			for (const auto& entry : slot) earliest = std::min(earliest, entry.dueDay);
+		}
+	}
+	for (const auto& entry : overflow) earliest = std::min(earliest, entry.dueDay);
+	return earliest;
+}
+
+bool CommandScheduler::holdsMergeable(uint64_t key, uint64_t dueDay) const {
+	const auto found = key ? mergeable.find(key) : mergeable.end();
+	return found != mergeable.end() && found->second.readyDay == std::max(dueDay, today);
+}
+
+bool CommandScheduler::mergeIntoQueued(std::unique_ptr<Command>& cmd, uint64_t key, int urgency, uint64_t dueDay, uint64_t deadline) {
+	const auto found = mergeable.find(key);
+	if (found == mergeable.end() || found->second.readyDay != std::max(dueDay, today)) return false;
+	const bool isReady = found->second.bucket == nullptr;
+	const std::size_t readyIndex = found->second.index;
+	Entry* entry = &entryOf(found->second);
+
+	if (!entry->command->absorb(*cmd)) {
+		if (!cmd->absorb(*entry->command)) return false;
+		// The newcomer took the queued command in; it inherits the queued entry's place.
+		entry->command = std::move(cmd);
+		found->second.command = entry->command.get();
+	}
+	cmd.reset();
+	++merged;
+	entry->urgency = std::max(entry->urgency, urgency);
+	entry->deadline = std::min(entry->deadline, deadline);
+	// Both changes only move a ready entry towards the top: sift it up.
+	if (isReady) siftUp(readyIndex);
+	return true;
+}
+
+bool CommandScheduler::runsAfter(const Entry& a, const Entry& b) noexcept {
+	if (a.urgency != b.urgency) return a.urgency < b.urgency;
+	if (a.deadline != b.deadline) return a.deadline > b.deadline;
+	return a.sequence > b.sequence;
+}
+
+void CommandScheduler::pushReady(Entry entry) {
+	entry.readySince = std::chrono::steady_clock::now();
+	ready.emplace_back();
+	settle(std::move(entry), nullptr, ready.size() - 1);
+	siftUp(ready.size() - 1);
+}
+
+void CommandScheduler::siftUp(std::size_t index) {
+	Entry entry = std::move(ready[index]);
+	while (index > 0) {
+		const std::size_t parent = (index - 1) / 2;
+		if (!runsAfter(ready[parent], entry)) break;
+		settle(std::move(ready[parent]), nullptr, index);
+		index = parent;
+	}
+	settle(std::move(entry), nullptr, index);
+}
+
+void CommandScheduler::siftDown(std::size_t index) {
+	Entry entry = std::move(ready[index]);
+	const std::size_t count = ready.size();
+	for (;;) {
+		std::size_t child = 2 * index + 1;
+		if (child >= count) break;
+		if (child + 1 < count && runsAfter(ready[child], ready[child + 1])) ++child;
+		if (!runsAfter(entry, ready[child])) break;
+		settle(std::move(ready[child]), nullptr, index);
+		index = child;
+	}
+	settle(std::move(entry), nullptr, index);
+}
+
+void CommandScheduler::settle(Entry&& entry, std::vector<Entry>* bucket, std::size_t index) {
+	if (entry.merge) {
+		entry.merge->bucket = bucket;
+		entry.merge->index = index;
+	}
+	(bucket ? (*bucket)[index] : ready[index]) = std::move(entry);
+}
+
+void CommandScheduler::place(Entry entry) {
+	const uint64_t delta = entry.dueDay - today;
+	std::vector<Entry>* bucket = &overflow;
+	for (std::size_t level = 0; level < kWheelLevels; ++level) {
+		if (delta < slotSpan(level + 1)) {
+			bucket = &wheel[level][(entry.dueDay >> (kWheelBits * level)) & kSlotMask];
+			break;
+		}
+	}
+	bucket->emplace_back();
+	settle(std::move(entry), bucket, bucket->size() - 1);
+}
+
+void CommandScheduler::cascade(std::vector<Entry>& slot) {
+	std::vector<Entry> entries;
+	entries.swap(slot);
+	for (auto& entry : entries) {
+		if (entry.dueDay <= today) {
+			--deferred;
+			pushReady(std::move(entry));
+		} else {
+			place(std::move(entry));
+		}
+	}
+}
+
+CommandScheduler::QueueWaitStats& CommandScheduler::statsFor(const char* typeName) {
+	for (auto& entry : stats) {
+		if (entry.typeName == typeName || std::strcmp(entry.typeName, typeName) == 0) return entry;
+	}
+	stats.emplace_back();
+	stats.back().typeName = typeName;
+	return stats.back();
+}
@@ -1,19 +1,140 @@
 #include "../../include/Core/Inventory.h"
+#include "../../include/Components/Group.h"
+#include "../../include/Components/Plant.h"
 #include "../../include/Patterns/Iterator/CompositeIterator.h"
+#include "../../include/Patterns/Iterator/FilteredPreOrderTraversal.h"
+#include "../../include/Patterns/Iterator/PreOrderTraversal.h"
+
+#include <algorithm>
+
+namespace {
+
+// The top-level ancestor of 'component' in the ownership tree (itself when unowned).
+const InventoryComponent* rootOf(const InventoryComponent& component) {
+	const ComponentTree& tree = ComponentTree::shared();
+	ComponentTree::Handle node = component.treeNode();
+	while (tree.parent(node) != ComponentTree::kNull) node = tree.parent(node);
+	return tree.component(node);
+}
+
+} // namespace
+
+std::atomic<std::size_t> Inventory::registeredViews{0};
 
 Inventory::Inventory() = default;
 
-Inventory::~Inventory() = default;
+Inventory::~Inventory() {
+	for (const auto& entry : views) {
+		if (auto view = entry.lock()) view->bind(nullptr);
+	}
+	for (const auto& component : components) {
+		if (component->holder_ == this) component->holder_ = nullptr;
+	}
+}
 
 void Inventory::add(const std::shared_ptr<InventoryComponent>& component) {
-	(void)component; // stub
+	if (!component) return;
+	if (std::find(components.begin(), components.end(), component) != components.end()) return;
+	if (auto previousOwner = component->getOwner()) previousOwner->remove(component);
+	components.push_back(component);
+	component->holder_ = this;
+	track(*component);
+	InventoryComponent::touchTopology();
 }
 
 void Inventory::remove(const std::shared_ptr<InventoryComponent>& component) {
-	(void)component; // stub
+	auto found = std::find(components.begin(), components.end(), component);
+	if (found == components.end()) return;
+	untrack(*component);
+	components.erase(found);
+	if (component->holder_ == this) component->holder_ = nullptr;
+	InventoryComponent::touchTopology();
 }
 
 std::unique_ptr<Iterator> Inventory::createIterator() {
-	return nullptr;
+	return std::make_unique<CompositeIterator>(components, std::make_unique<PreOrderTraversal>());
+}
+
+std::unique_ptr<Iterator> Inventory::createIterator(TraversalFilter filter) {
+	return std::make_unique<CompositeIterator>(components, std::make_unique<FilteredPreOrderTraversal>(std::move(filter)));
+}
+
+std::vector<ComponentTree::Handle> Inventory::collectNodes(const TraversalStrategy& strategy) const {
+	const ComponentTree& tree = ComponentTree::shared();
+	std::vector<ComponentTree::Handle> nodes;
+	for (const auto& component : components) strategy.traverse(tree, component->treeNode(), nodes);
+	return nodes;
+}
+
+Inventory* Inventory::holding(const InventoryComponent& component) { return rootOf(component)->holder_; }
+
+bool Inventory::contains(const InventoryComponent& component) const { return holding(component) == this; }
+
+std::shared_ptr<Plant> Inventory::findAvailable(WaterLevel maxWater, SunLevel maxSun, const std::string& name) {
+	return plantIndex.findAvailable(*this, maxWater, maxSun, name);
 }
 
+std::shared_ptr<Group> Inventory::createView(const std::string& name, Group::Predicate predicate) {
+	auto view = std::make_shared<Group>(name, std::move(predicate));
+	view->bind(this);
+	views.erase(std::remove_if(views.begin(), views.end(),
+		[](const std::weak_ptr<Group>& entry) { return entry.expired(); }), views.end());
+	views.push_back(view);
+	return view;
+}
+
+void Inventory::track(InventoryComponent& component) {
+	InventoryComponent* const one = &component;
+	track(&one, 1);
+}
+
+void Inventory::untrack(const InventoryComponent& component) {
+	const InventoryComponent* const one = &component;
+	untrack(&one, 1);
+}
+
+void Inventory::track(InventoryComponent* const* moved, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) plantIndex.addSubtree(*moved[i]);
+	if (views.empty()) return;
+	const ComponentTree& tree = ComponentTree::shared();
+	for (const auto& entry : views) {
+		auto view = entry.lock();
+		if (!view) continue;
+		for (std::size_t i = 0; i < count; ++i) {
+			tree.forEachPreOrder(moved[i]->treeNode(), [&](ComponentTree::Handle node) {
+				InventoryComponent* plant = tree.component(node);
+				if (dynamic_cast<Plant*>(plant)) view->select(*plant);
+			});
+		}
+	}
+}
+
+void Inventory::untrack(const InventoryComponent* const* moved, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) plantIndex.removeSubtree(*moved[i]);
+	if (views.empty()) return;
+	const ComponentTree& tree = ComponentTree::shared();
+	for (const auto& entry : views) {
+		auto view = entry.lock();
+		if (!view) continue;
+		for (std::size_t i = 0; i < count; ++i) {
+			tree.forEachPreOrder(moved[i]->treeNode(), [&](ComponentTree::Handle node) { view->deselect(*tree.component(node)); });
+		}
+	}
+}
+
+void Inventory::placed(InventoryComponent& component) {
+	if (Inventory* inventory = holding(component)) inventory->track(component);
+}
+
+void Inventory::leaving(const InventoryComponent& component) {
+	if (Inventory* inventory = holding(component)) inventory->untrack(component);
+}
+
+void Inventory::stateChanged(Plant& plant) {
+	if (registeredViews.load(std::memory_order_relaxed) == 0) return;
+	Inventory* inventory = holding(plant);
+	if (!inventory) return;
+	for (const auto& entry : inventory->views) {
+		if (auto view = entry.lock()) view->noteChanged(plant);
+	}
+}
@@ -0,0 +1,143 @@
+#include "../../include/Core/Json.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+// Index of the quote closing the string that opens at 'open' (text.size() if unterminated).
+std::size_t stringEnd(std::string_view text, std::size_t open) {
+	for (std::size_t i = open + 1; i < text.size(); ++i) {
+		if (text[i] == '\\') ++i;
+		else if (text[i] == '"') return i;
+	}
+	return text.size();
+}
+
+// Index just past the value starting at 'begin': the next ',', '}' or ']' outside any nesting.
+std::size_t valueEnd(std::string_view text, std::size_t begin) {
+	int depth = 0;
+	std::size_t i = begin;
+	for (; i < text.size(); ++i) {
+		const char c = text[i];
+		if (c == '"') {
+			i = stringEnd(text, i);
+		} else if (c == '{' || c == '[') {
+			++depth;
+		} else if (c == '}' || c == ']') {
+			if (depth == 0) break;
+			--depth;
+		} else if (c == ',' && depth == 0) {
+			break;
+		}
+	}
+	return i;
+}
+
+bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+// Appends code point 'code' (below 0x10000) as UTF-8.
+void appendUtf8(std::string& out, unsigned code) {
+	if (code < 0x80) {
+		out.push_back(static_cast<char>(code));
+	} else if (code < 0x800) {
+		out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+		out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+	} else {
+		out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+		out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+		out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+	}
+}
+
+} // namespace
+
+namespace Json {
+
+std::string quote(std::string_view text) {
+	std::string out;
+	out.reserve(text.size() + 2);
+	out.push_back('"');
+	for (const char c : text) {
+		switch (c) {
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+				out += escaped;
+			} else {
+				out.push_back(c);
+			}
+		}
+	}
+	out.push_back('"');
+	return out;
+}
+
+std::string number(double value) {
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+	return buffer;
+}
+
+std::string_view field(std::string_view object, std::string_view key) {
+	int depth = 0;
+	for (std::size_t i = 0; i < object.size(); ++i) {
+		const char c = object[i];
+		if (c == '"') {
+			const std::size_t close = stringEnd(object, i);
+			std::size_t next = close + 1;
+			while (next < object.size() && isSpace(object[next])) ++next;
+			// Keys are the only strings followed by ':'.
+			if (depth == 1 && next < object.size() && object[next] == ':' && object.substr(i + 1, close - i - 1) == key) {
+				std::size_t begin = next + 1;
+				while (begin < object.size() && isSpace(object[begin])) ++begin;
+				std::size_t end = valueEnd(object, begin);
+				while (end > begin && isSpace(object[end - 1])) --end;
+				return object.substr(begin, end - begin);
+			}
+			i = close;
+		} else if (c == '{' || c == '[') {
+			++depth;
+		} else if (c == '}' || c == ']') {
+			--depth;
+		}
+	}
+	return {};
+}
+
+std::string unquote(std::string_view literal) {
+	if (literal.size() < 2 || literal.front() != '"' || literal.back() != '"') return std::string(literal);
+	std::string out;
+	out.reserve(literal.size() - 2);
+	for (std::size_t i = 1; i + 1 < literal.size(); ++i) {
+		const char c = literal[i];
+		if (c != '\\' || i + 2 >= literal.size()) {
+			out.push_back(c);
+			continue;
+		}
+		switch (const char escaped = literal[++i]) {
+		case 'n': out.push_back('\n'); break;
+		case 'r': out.push_back('\r'); break;
+		case 't': out.push_back('\t'); break;
+		case 'b': out.push_back('\b'); break;
+		case 'f': out.push_back('\f'); break;
+		case 'u':
+			if (i + 5 < literal.size()) {
+				const std::string digits(literal.substr(i + 1, 4));
+				appendUtf8(out, static_cast<unsigned>(std::strtoul(digits.c_str(), nullptr, 16)));
+				i += 4;
+			}
+			break;
+		default: out.push_back(escaped); break; // '"', '\\' and '/'
+		}
+	}
+	return out;
+}
+
+} // namespace Json
@@ -1,22 +1,948 @@
 #include "../../include/Core/Nursery.h"
+#include "../../include/Core/Inventory.h"
+#include "../../include/Core/CounterRng.h"
+#include "../../include/Core/ThreadPool.h"
+#include "../../include/Components/Group.h"
+#include "../../include/Components/Plant.h"
+#include "../../include/Components/TypeRegistry.h"
+#include "../../include/Actors/Gardener.h"
+#include "../../include/Actors/Cashier.h"
+#include "../../include/Actors/Customer.h"
+#include "../../include/Patterns/Builder/ConcretePlantSpecificationBuilder.h"
 #include "../../include/Patterns/Command/Command.h"
+#include "../../include/Patterns/Command/BatchWaterCommand.h"
+#include "../../include/Patterns/Command/WaterPlantCommand.h"
+#include "../../include/Patterns/Command/FulfillCustomerCommand.h"
+#include "../../include/Patterns/Decorator/PlantDecorator.h"
+#include "../../include/Patterns/Factory/RoseFactory.h"
+#include "../../include/Patterns/Factory/CactusFactory.h"
 #include "../../include/Patterns/Memento/Memento.h"
+#include "../../include/Patterns/Memento/InventorySnapshot.h"
+#include "../../include/Patterns/Observer/NurserySupervisor.h"
 
-Nursery::Nursery() : currentDay(0) {}
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+/**
+ * @brief A slice of the day tick that can run independently of every other unit.
+ *
+ * Each owning Group contributes one unit holding its direct plants; plants at the
+ * top level of the inventory share one extra unit. Plants are recorded as runs of
+ * consecutive PlantStore slots so the columnar kernel can be applied per run.
+ */
+struct Nursery::TickUnit {
+	struct SlotRun {
+		PlantStore* store;
+		std::size_t storeIndex; // Index of 'store' in storeSlots.
+		PlantStore::Slot begin;
+		PlantStore::Slot end;
+	};
+
+	uint64_t streamId{0};                       // Random stream key: the plot's id (0 for loose plants).
+	Group* plot{nullptr};                       // Owner of every plant in 'runs'; null for loose plants.
+	std::vector<SlotRun> runs;
+	std::size_t slotCount{0};                     // Slots covered by 'runs'.
+	PlantStore::RangeState plantState;            // State of 'runs' after the last tick, for the plot.
+	// Stage and water level of every slot of 'runs', in order, before the tick: the 'before'
+	// of its events. Only filled while someone is subscribed to the plant events.
+	std::vector<uint8_t> priorStages;
+	std::vector<int32_t> priorWaterLevels;
+	LifecycleCounters counters;                   // Lifecycle statistics for this unit's last tick.
+	// Changed plants with attached observers, called on the simulation thread after the tick.
+	std::vector<std::weak_ptr<Subject>> observed;
+	// Summed weather loss over the days of simulateUntil()'s window (DeferredDays::windowStart on).
+	std::vector<int32_t> weatherPrefix;
+	// Within simulateUntil(): no deferred slot of 'runs' was last synced before this day.
+	uint32_t syncedFrom{0};
+};
+
+/**
+ * @brief Slot-indexed bookkeeping for one PlantStore holding tick unit plants.
+ *
+ * Kept across rebuilds of the tick units, so a rebuild can tell which plants
+ * changed unit (and possibly weather stream) and which left the tick.
+ */
+struct Nursery::StoreSlots {
+	PlantStore* store;
+	std::vector<uint32_t> units;   // Index into tickUnits per slot, kNoUnit if the slot is in none.
+	std::vector<uint32_t> dueDays; // Queued event day of a deferred slot (DeferredDays::queue), 0 if none.
+	std::vector<uint8_t> marks;    // Scratch flags, all clear between calls (rebuildTickUnits(), scheduleRescheduled()).
+};
+
+/**
+ * @brief simulateUntil()'s event queue, and the catch-up of the plants it defers.
+ *
+ * Deferred slots were last ticked (or caught up) on PlantStore::syncedDay() and
+ * raise no event until their queued day. The window bounds the weather prefixes
+ * the tick units hold: every deferred slot is synced to windowStart or later,
+ * and its queued day, if any, is at most windowEnd.
+ */
+struct Nursery::DeferredDays {
+	struct Due {
+		uint32_t storeIndex;
+		PlantStore::Slot slot;
+	};
+
+	// Brings every deferred slot of 'run' (part of 'unit') up to 'day', one fastForward() per
+	// stretch synced the same day.
+	void catchUpRun(const TickUnit& unit, const TickUnit::SlotRun& run, uint32_t day) const noexcept;
+	// Same for all of 'unit', unless TickUnit::syncedFrom shows it is there already.
+	void catchUpUnit(TickUnit& unit, uint32_t day) const noexcept;
+
+	uint32_t windowStart{0};
+	uint32_t windowEnd{0};
+	// Bucket queue, one bucket per day of the window (windowStart first). An entry whose
+	// bucket differs from StoreSlots::dueDays, or whose slot is no longer deferred, is stale.
+	std::vector<std::vector<Due>> queue;
+	// Slots ticked today, queued again with the slots written to (Nursery::scheduleRescheduled()).
+	std::vector<std::pair<std::size_t, PlantStore::Slot>> ticked;
+	LifecycleCounters dayCounters; // Transitions of the plants ticked on the last day.
+};
+
+namespace {
+
+// Random stream for customer requests; plot streams use plot ids and never reach it.
+constexpr uint64_t kCustomerStream = ~0ull;
+
+// Appends 'item' to a comma-separated JSON list body.
+void appendItem(std::string& list, const std::string& item) {
+	if (!list.empty()) list += ',';
+	list += item;
+}
+
+// Days simulateUntil() solves plant events ahead for at a time: each tick unit holds
+// the weather prefix of the window, and every plant is caught up when a window ends.
+constexpr uint32_t kDeferWindow = 1024;
+
+// A unit with at least one in this many of its plants due is ticked whole by tickDuePlants().
+constexpr std::size_t kDenseDueShare = 32;
+
+// StoreSlots::units of a slot that belongs to no tick unit.
+constexpr uint32_t kNoUnit = std::numeric_limits<uint32_t>::max();
+
+// Submissions the inbox holds before producers spill into the overflow list.
+constexpr std::size_t kRequestInboxCapacity = std::size_t{1} << 14;
+
+// Finds the plant behind a component, looking through any decorators.
+Plant* plantOf(InventoryComponent* component) {
+	while (auto decorator = dynamic_cast<PlantDecorator*>(component)) {
+		component = decorator->getWrappedComponent().get();
+	}
+	return dynamic_cast<Plant*>(component);
+}
+
+// A plant's slot plus the first-appearance rank of its store (not its address),
+// so units sort the same way on every run.
+struct SlotRef {
+	std::size_t storeRank;
+	PlantStore* store;
+	PlantStore::Slot slot;
+};
+
+} // namespace
+
+Nursery::Nursery()
+	: currentDay(0), requestInbox(kRequestInboxCapacity), inboxOverflowing(false), inboxOverflowSize(0),
+	  coalescedRequests(0), stagedRequests(nullptr), customersPerDay(1), customersSpawned(0), tickUnitsVersion(std::numeric_limits<uint64_t>::max()), tickUnitsSeed(0), threadCount(1), seed(0) {
+	setupNursery();
+}
 
 Nursery::~Nursery() = default;
 
-void Nursery::runSimulation() { }
+void Nursery::runSimulation(int days) {
+	for (int day = 0; day < days; ++day) runDay();
+}
+
+void Nursery::runDay() {
+	++currentDay;
+	requestQueue.advanceTo(static_cast<uint64_t>(currentDay));
+	staffRouter.startDay();
+	timePhase(Phase::Tick, [this] {
+		if (deferred) tickDuePlants();
+		else tickPlants();
+	});
+	// Customers and commands may reach any plant: simulateUntil() brings its deferred ones up to today first.
+	timePhase(Phase::SpawnCustomers, [this] {
+		if (deferred && customersPerDay > 0) catchUpDeferred();
+		for (int i = 0; i < customersPerDay; ++i) spawnCustomer();
+	});
+	timePhase(Phase::ProcessRequests, [this] {
+		if (deferred && requestsWaiting()) catchUpDeferred();
+		processRequestQueue();
+	});
+}
+
+bool Nursery::defragmentTree() {
+	ComponentTree& tree = ComponentTree::shared();
+	if (!tree.fragmented()) return false;
+	tree.defragment();
+	return true;
+}
+
+void Nursery::simulateUntil(int day) {
+	if (currentDay >= day) return;
+	deferred = std::make_unique<DeferredDays>();
+	deferred->windowEnd = static_cast<uint32_t>(currentDay); // opens the first window
+	try {
+		while (currentDay < day) {
+			// Commands change the inventory after the tick; units are regrouped before the next one.
+			if (tickUnitsVersion != InventoryComponent::topologyVersion()) rebuildTickUnits();
+			if (static_cast<uint32_t>(currentDay) >= deferred->windowEnd) openDeferWindow(day);
+			scheduleRescheduled();
+			if (!skipQuietDays(day)) runDay();
+		}
+	} catch (...) {
+		endDeferral();
+		throw;
+	}
+	endDeferral();
+}
+
+void Nursery::DeferredDays::catchUpRun(const TickUnit& unit, const TickUnit::SlotRun& run, uint32_t day) const noexcept {
+	PlantStore& store = *run.store;
+	const uint32_t to = day;
+	// The days passing already advanced stateVersion() (skipQuietDays(), tickDuePlants()), so the
+	// state is not needed; asking for it keeps catching up from moving the version again.
+	PlantStore::RangeState state;
+	for (PlantStore::Slot begin = run.begin; begin < run.end;) {
+		const uint32_t from = store.syncedDay(begin);
+		PlantStore::Slot end = begin + 1;
+		while (end < run.end && store.syncedDay(end) == from) ++end;
+		if (from < to) { // neither current nor kNotDeferred
+			store.fastForward(begin, end, unit.weatherPrefix.data() + (from - windowStart), to - from, nullptr, &state);
+			for (PlantStore::Slot slot = begin; slot < end; ++slot) store.defer(slot, to);
+		}
+		begin = end;
+	}
+}
+
+void Nursery::DeferredDays::catchUpUnit(TickUnit& unit, uint32_t day) const noexcept {
+	if (unit.syncedFrom >= day) return;
+	for (const auto& run : unit.runs) catchUpRun(unit, run, day);
+	unit.syncedFrom = day;
+}
+
+void Nursery::catchUpDeferred() {
+	const auto today = static_cast<uint32_t>(currentDay);
+	const DeferredDays& window = *deferred;
+	if (workers) {
+		workers->parallelFor(tickUnits.size(), [&](std::size_t index) { window.catchUpUnit(tickUnits[index], today); });
+	} else {
+		for (auto& unit : tickUnits) window.catchUpUnit(unit, today);
+	}
+}
+
+bool Nursery::requestsWaiting() const noexcept {
+	return requestQueue.readyCount() > 0 || requestInbox.sizeApprox() > 0
+		|| inboxOverflowing.load(std::memory_order_acquire);
+}
+
+void Nursery::openDeferWindow(int day) {
+	DeferredDays& window = *deferred;
+	auto forEachUnit = [this](auto&& fn) {
+		if (workers) workers->parallelFor(tickUnits.size(), [&](std::size_t index) { fn(tickUnits[index]); });
+		else for (auto& unit : tickUnits) fn(unit);
+	};
+	// Catch up with the old window's weather before it is replaced.
+	const auto today = static_cast<uint32_t>(currentDay);
+	forEachUnit([&window, today](TickUnit& unit) { window.catchUpUnit(unit, today); });
+
+	window.windowStart = today;
+	window.windowEnd = std::min(static_cast<uint32_t>(day), today + kDeferWindow);
+	for (auto& bucket : window.queue) bucket.clear();
+	window.queue.resize(window.windowEnd - today + 1);
+	window.ticked.clear();
+	for (auto& slots : storeSlots) slots.store->takeRescheduled();
+	forEachUnit([&](TickUnit& unit) {
+		computeWeatherPrefix(unit, today, window.windowEnd - today);
+		unit.syncedFrom = today;
+		for (const auto& run : unit.runs) {
+			StoreSlots& slots = storeSlots[run.storeIndex];
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) {
+				if (static_cast<uint8_t>(run.store->stage(slot)) == PlantStore::kFreeSlot) continue;
+				run.store->defer(slot, today);
+				const uint32_t quiet = run.store->quietDays(slot, slot + 1, today, unit.weatherPrefix.data(),
+					window.windowEnd - today);
+				const uint32_t due = today + quiet + 1;
+				slots.dueDays[slot] = due <= window.windowEnd ? due : 0;
+			}
+		}
+	});
+	// Queued in unit order, on this thread.
+	for (const auto& unit : tickUnits) {
+		for (const auto& run : unit.runs) {
+			const StoreSlots& slots = storeSlots[run.storeIndex];
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) {
+				const uint32_t due = slots.dueDays[slot];
+				if (due) window.queue[due - today].push_back({static_cast<uint32_t>(run.storeIndex), slot});
+			}
+		}
+	}
+}
+
+void Nursery::scheduleDue(std::size_t storeIndex, uint32_t slot) {
+	DeferredDays& window = *deferred;
+	StoreSlots& slots = storeSlots[storeIndex];
+	PlantStore& store = *slots.store;
+	const TickUnit& unit = tickUnits[slots.units[slot]];
+	const uint32_t from = store.syncedDay(slot);
+	const uint32_t due = from + 1 + store.quietDays(slot, slot + 1, from,
+		unit.weatherPrefix.data() + (from - window.windowStart), window.windowEnd - from);
+	slots.dueDays[slot] = due <= window.windowEnd ? due : 0;
+	if (due > window.windowEnd) return;
+	window.queue[due - window.windowStart].push_back({static_cast<uint32_t>(storeIndex), slot});
+}
+
+void Nursery::scheduleRescheduled() {
+	// A plant ticked yesterday is often watered the same day: solve it once.
+	auto& slots = deferred->ticked;
+	for (std::size_t index = 0; index < storeSlots.size(); ++index) {
+		for (PlantStore::Slot slot : storeSlots[index].store->takeRescheduled()) slots.emplace_back(index, slot);
+	}
+	for (const auto& [storeIndex, slot] : slots) {
+		StoreSlots& owner = storeSlots[storeIndex];
+		if (!owner.store->deferred(slot) || owner.marks[slot]) continue;
+		owner.marks[slot] = 1;
+		scheduleDue(storeIndex, slot);
+	}
+	for (const auto& [storeIndex, slot] : slots) storeSlots[storeIndex].marks[slot] = 0;
+	slots.clear();
+}
+
+bool Nursery::skipQuietDays(int day) {
+	if (customersPerDay > 0 || requestsWaiting()) return false;
+	DeferredDays& window = *deferred;
+	uint64_t until = std::min<uint64_t>(static_cast<uint64_t>(day), window.windowEnd);
+	const uint64_t nextDue = requestQueue.nextDueDay();
+	if (nextDue <= until) until = nextDue - 1;
+	for (auto next = static_cast<uint32_t>(currentDay) + 1; next <= until; ++next) {
+		auto& bucket = window.queue[next - window.windowStart];
+		const bool due = std::any_of(bucket.begin(), bucket.end(), [&](const DeferredDays::Due& entry) {
+			const StoreSlots& slots = storeSlots[entry.storeIndex];
+			return slots.dueDays[entry.slot] == next && slots.store->deferred(entry.slot);
+		});
+		if (due) {
+			until = next - 1;
+			break;
+		}
+		bucket.clear(); // all stale
+	}
+	if (until <= static_cast<uint64_t>(currentDay)) return false;
+
+	// Nothing but decay happens in between; the plants catch up before anyone reads them.
+	currentDay = static_cast<int>(until);
+	requestQueue.advanceTo(until);
+	window.dayCounters.clear();
+	PlantStore::markStateChanged();
+	ComponentTree::shared().markAllChanged();
+	return true;
+}
+
+void Nursery::tickDuePlants() {
+	DeferredDays& window = *deferred;
+	const auto today = static_cast<uint32_t>(currentDay);
+	std::vector<DeferredDays::Due> due;
+	due.swap(window.queue[today - window.windowStart]);
+	std::vector<uint32_t> dueCount(tickUnits.size(), 0);
+	due.erase(std::remove_if(due.begin(), due.end(), [&](const DeferredDays::Due& entry) {
+		StoreSlots& slots = storeSlots[entry.storeIndex];
+		uint32_t& dueDay = slots.dueDays[entry.slot];
+		if (dueDay != today || !slots.store->deferred(entry.slot)) return true; // rescheduled or gone
+		dueDay = 0;
+		++dueCount[slots.units[entry.slot]];
+		return false;
+	}), due.end());
+	// A unit with enough of its plants due is ticked whole; the due plants of the others
+	// are picked out in the full tick's order, by slot.
+	auto dense = [&](std::size_t unit) { return dueCount[unit] * kDenseDueShare >= tickUnits[unit].slotCount; };
+	std::vector<std::pair<uint32_t, DeferredDays::Due>> picked;
+	for (const auto& entry : due) {
+		const uint32_t unit = storeSlots[entry.storeIndex].units[entry.slot];
+		if (!dense(unit)) picked.push_back({unit, entry});
+	}
+	std::sort(picked.begin(), picked.end(), [](const auto& a, const auto& b) {
+		if (a.first != b.first) return a.first < b.first;
+		return a.second.storeIndex != b.second.storeIndex ? a.second.storeIndex < b.second.storeIndex
+			: a.second.slot < b.second.slot;
+	});
+
+	const bool recording = plantEvents.hasSubscribers();
+	std::vector<std::weak_ptr<Subject>> observed;
+	window.dayCounters.clear();
+	std::vector<int32_t> priorStages;
+	std::vector<int32_t> priorWaterLevels;
+	std::size_t first = 0; // into 'picked'
+	for (std::size_t index = 0; index < tickUnits.size(); ++index) {
+		if (!dueCount[index]) continue;
+		TickUnit& unit = tickUnits[index];
+		if (dense(index)) {
+			// The rest of the plot stays quiet through its queued day, so it raises no event today.
+			window.catchUpUnit(unit, today - 1);
+			runTickUnit(unit);
+			window.dayCounters += unit.counters;
+			observed.insert(observed.end(), unit.observed.begin(), unit.observed.end());
+			for (const auto& run : unit.runs) {
+				for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) {
+					if (run.store->deferred(slot)) run.store->defer(slot, today);
+				}
+			}
+			unit.syncedFrom = today;
+			continue;
+		}
+
+		const int32_t extraWaterLoss = weatherLoss(unit.streamId, today);
+		const std::size_t unitEnd = first + dueCount[index];
+		while (first < unitEnd) {
+			// Due plants of a unit often sit in consecutive slots (a plot watered together); tick them as one run.
+			const DeferredDays::Due& head = picked[first].second;
+			std::size_t last = first + 1;
+			while (last < unitEnd && picked[last].second.storeIndex == head.storeIndex
+				&& picked[last].second.slot == picked[last - 1].second.slot + 1) {
+				++last;
+			}
+			PlantStore& store = *storeSlots[head.storeIndex].store;
+			const PlantStore::Slot begin = head.slot;
+			const PlantStore::Slot end = begin + static_cast<PlantStore::Slot>(last - first);
+			first = last;
+
+			// The unit's plants are consecutive in its runs, so the due stretch lies within one of them.
+			window.catchUpRun(unit, {&store, head.storeIndex, begin, end}, today - 1);
+			priorStages.clear();
+			priorWaterLevels.clear();
+			for (PlantStore::Slot slot = begin; slot < end; ++slot) {
+				priorStages.push_back(static_cast<int32_t>(store.stage(slot)));
+				priorWaterLevels.push_back(store.waterLevel(slot));
+			}
+			store.tickRange(begin, end, extraWaterLoss, &window.dayCounters);
+			for (PlantStore::Slot slot = begin; slot < end; ++slot) store.defer(slot, today);
+
+			store.forEachEvent(begin, end, [&](Plant* plant, uint8_t events) {
+				Inventory::stateChanged(*plant);
+				if (plant->hasObservers()) observed.push_back(plant->Subject::weak_from_this());
+				if (!recording) return;
+				const PlantStore::Slot slot = plant->getSlot();
+				if (events & PlantStore::BecameThirsty) {
+					plantEvents.record({plant, plant->getId(), priorWaterLevels[slot - begin], store.waterLevel(slot),
+						PlantEvent::Field::WaterLevel});
+				}
+				if (events & PlantStore::StageChanged) {
+					plantEvents.record({plant, plant->getId(), priorStages[slot - begin], static_cast<int32_t>(store.stage(slot)),
+						PlantEvent::Field::Stage});
+				}
+			});
+		}
+	}
+	// Every deferred plant aged a day, unseen by its Group and by snapshots.
+	PlantStore::markStateChanged();
+	ComponentTree::shared().markAllChanged();
+	for (const auto& entry : due) window.ticked.emplace_back(entry.storeIndex, entry.slot);
+
+	for (const auto& entry : observed) {
+		if (auto subject = entry.lock()) static_cast<Plant&>(*subject).notifyObservers();
+	}
+	publishPlantEvents();
+}
+
+void Nursery::endDeferral() {
+	if (tickUnitsVersion != InventoryComponent::topologyVersion()) rebuildTickUnits();
+	const auto today = static_cast<uint32_t>(currentDay);
+	auto finishUnit = [this, today](TickUnit& unit) {
+		unit.plantState = PlantStore::RangeState{};
+		for (const auto& run : unit.runs) {
+			deferred->catchUpRun(unit, run, today);
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) run.store->undefer(slot);
+			run.store->summarize(run.begin, run.end, unit.plantState);
+		}
+	};
+	if (workers) {
+		workers->parallelFor(tickUnits.size(), [&](std::size_t index) { finishUnit(tickUnits[index]); });
+	} else {
+		for (auto& unit : tickUnits) finishUnit(unit);
+	}
+	for (auto& slots : storeSlots) {
+		slots.store->takeRescheduled();
+		std::fill(slots.dueDays.begin(), slots.dueDays.end(), 0u);
+	}
+
+	// As the full tick would have left it: today's population, and the transitions of today's due plants.
+	lifecycleReport.clear();
+	lifecycleReport.ruleHits = deferred->dayCounters.ruleHits;
+	for (const auto& unit : tickUnits) {
+		for (std::size_t stage = 0; stage < kLifecycleStageCount; ++stage) {
+			lifecycleReport.population[stage] += unit.plantState.stageCounts[stage];
+		}
+	}
+	assignPlotStates();
+	deferred.reset();
+}
+
+std::size_t Nursery::storeIndexOf(PlantStore* store) {
+	for (std::size_t index = 0; index < storeSlots.size(); ++index) {
+		if (storeSlots[index].store == store) return index;
+	}
+	storeSlots.push_back(StoreSlots{store, {}, {}, {}});
+	return storeSlots.size() - 1;
+}
 
-void Nursery::addRequest(std::unique_ptr<Command> cmd) { (void)cmd; }
+void Nursery::computeWeatherPrefix(TickUnit& unit, uint32_t fromDay, uint32_t days) const {
+	auto& prefix = unit.weatherPrefix;
+	prefix.resize(static_cast<std::size_t>(days) + 1);
+	prefix[0] = 0;
+	for (uint32_t k = 1; k <= days; ++k) {
+		prefix[k] = prefix[k - 1] + weatherLoss(unit.streamId, static_cast<uint64_t>(fromDay) + k);
+	}
+}
 
-Memento* Nursery::createMemento() const { return nullptr; }
+int32_t Nursery::weatherLoss(uint64_t streamId, uint64_t day) const noexcept {
+	return static_cast<int32_t>(CounterRng(seed, streamId).uniform(day, LifecycleRules::kMaxWeatherLoss + 1));
+}
+
+template <typename Fn>
+void Nursery::timePhase(Phase phase, Fn&& fn) {
+	if (!phaseTimer) {
+		fn();
+		return;
+	}
+	const auto start = std::chrono::steady_clock::now();
+	fn();
+	phaseTimer(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+}
+
+void Nursery::setThreadCount(unsigned count) {
+	if (count == 0) count = std::max(1u, std::thread::hardware_concurrency());
+	threadCount = count;
+	workers = count > 1 ? std::make_unique<ThreadPool>(count) : nullptr;
+}
+
+std::shared_ptr<Group> Nursery::addPlot(const std::string& name, const std::shared_ptr<Group>& parent) {
+	auto plot = std::make_shared<Group>(name);
+	if (parent) parent->add(plot);
+	else inventory->add(plot);
+	return plot;
+}
+
+void Nursery::setPlantFactory(ComponentTypeId species, std::shared_ptr<PlantFactory> factory) {
+	if (species >= plantFactories.size()) plantFactories.resize(static_cast<std::size_t>(species) + 1);
+	plantFactories[species] = std::move(factory);
+	plantSpecies.erase(std::remove(plantSpecies.begin(), plantSpecies.end(), species), plantSpecies.end());
+	if (!plantFactories[species]) return;
+	const TypeRegistry& types = TypeRegistry::shared();
+	const auto position = std::find_if(plantSpecies.begin(), plantSpecies.end(), [&](ComponentTypeId other) {
+		return types.info(species).name.view() < types.info(other).name.view();
+	});
+	plantSpecies.insert(position, species);
+}
+
+std::shared_ptr<Plant> Nursery::stockPlant(ComponentTypeId species, const std::shared_ptr<Group>& plot) {
+	if (species >= plantFactories.size() || !plantFactories[species]) return nullptr;
+	auto plant = plantFactories[species]->createPlant();
+	if (!plant) return nullptr;
+	getSupervisor()->watch(*plant);
+	if (plot) plot->add(plant);
+	else inventory->add(plant);
+	return plant;
+}
+
+std::shared_ptr<Plant> Nursery::stockPlant(const std::string& species, const std::shared_ptr<Group>& plot) {
+	return stockPlant(TypeRegistry::shared().idOf(species), plot);
+}
+
+std::vector<std::shared_ptr<Plant>> Nursery::stockPlants(ComponentTypeId species, std::size_t count,
+	const std::shared_ptr<Group>& plot) {
+	if (species >= plantFactories.size() || !plantFactories[species]) return {};
+	auto plants = plantFactories[species]->createPlants(count);
+	const auto& watcher = getSupervisor();
+	for (const auto& plant : plants) {
+		watcher->watch(*plant);
+		if (plot) plot->add(plant);
+		else inventory->add(plant);
+	}
+	return plants;
+}
+
+std::vector<std::shared_ptr<Plant>> Nursery::stockPlants(const std::string& species, std::size_t count,
+	const std::shared_ptr<Group>& plot) {
+	return stockPlants(TypeRegistry::shared().idOf(species), count, plot);
+}
+
+void Nursery::addRequest(std::unique_ptr<Command> cmd) { scheduleRequest(std::move(cmd), 0); }
+
+void Nursery::scheduleRequest(std::unique_ptr<Command> cmd, unsigned daysAhead) {
+	if (!cmd) return;
+	PendingRequest request{std::move(cmd), daysAhead};
+	if (stagingThread.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+		stagedRequests->push_back(std::move(request));
+		return;
+	}
+	if (!inboxOverflowing.load(std::memory_order_acquire) && requestInbox.tryPush(std::move(request))) return;
+	std::lock_guard<std::mutex> lock(inboxOverflowMutex);
+	inboxOverflow.push_back(std::move(request));
+	inboxOverflowSize.store(inboxOverflow.size(), std::memory_order_release);
+	inboxOverflowing.store(true, std::memory_order_release);
+}
+
+void Nursery::drainRequestInbox() {
+	std::vector<PendingRequest> drained;
+	requestInbox.drain([&drained](PendingRequest&& request) { drained.push_back(std::move(request)); });
+	// drain() stops at a cell a producer has claimed but not yet published, and that producer's
+	// later submissions may sit in the overflow list. So the list waits until the ring is empty;
+	// while the flag stays set, producers keep spilling behind it.
+	if (inboxOverflowing.load(std::memory_order_acquire) && requestInbox.empty()) {
+		std::lock_guard<std::mutex> lock(inboxOverflowMutex);
+		for (auto& request : inboxOverflow) drained.push_back(std::move(request));
+		inboxOverflow.clear();
+		inboxOverflowSize.store(0, std::memory_order_release);
+		inboxOverflowing.store(false, std::memory_order_release);
+	}
+
+	coalesceWaterings(drained);
+	for (auto& request : drained) {
+		requestQueue.schedule(std::move(request.command), static_cast<uint64_t>(currentDay) + request.daysAhead);
+	}
+}
+
+void Nursery::coalesceWaterings(std::vector<PendingRequest>& requests) {
+	if (requests.empty()) return;
+
+	struct PlotBatch {
+		std::shared_ptr<Group> plot;
+		std::vector<std::shared_ptr<Plant>> plants;
+		std::size_t position; // index in 'merged' holding the plot's first watering
+	};
+	std::vector<PlotBatch> batches;
+	std::unordered_map<const Group*, std::size_t> batchOfPlot;
+	std::unordered_set<uint64_t> targeted;
+	std::vector<PendingRequest> merged;
+	merged.reserve(requests.size());
+
+	for (auto& request : requests) {
+		auto water = request.daysAhead == 0 ? dynamic_cast<WaterPlantCommand*>(request.command.get()) : nullptr;
+		auto plant = water ? water->getTarget() : nullptr;
+		if (!plant) {
+			merged.push_back(std::move(request)); // not coalescible (or an expired target that should fail as usual)
+			continue;
+		}
+		if (!targeted.insert(plant->getId()).second) {
+			++coalescedRequests;
+			continue;
+		}
+		auto owner = plant->getOwner();
+		auto found = batchOfPlot.find(owner.get());
+		if (found == batchOfPlot.end()) {
+			found = batchOfPlot.emplace(owner.get(), batches.size()).first;
+			batches.push_back({std::move(owner), {}, merged.size()});
+			merged.push_back(std::move(request));
+		} else {
+			++coalescedRequests;
+		}
+		batches[found->second].plants.push_back(std::move(plant));
+	}
+
+	const auto today = static_cast<uint64_t>(currentDay);
+	for (auto& batch : batches) {
+		// A lone watering stays a plain WaterPlantCommand, unless the queue already holds one
+		// for the plot: as a batch it can take that one in (see CommandScheduler::schedule()).
+		if (batch.plants.size() < 2 && !requestQueue.holdsMergeable(WaterPlantCommand::plotKey(batch.plot.get()), today)) continue;
+		merged[batch.position].command = std::make_unique<BatchWaterCommand>(batch.plot, batch.plants);
+	}
+	requests.swap(merged);
+}
+
+Memento* Nursery::createMemento() {
+	std::string commands;
+	requestQueue.forEach([&commands](const Command& cmd, uint64_t dueDay) {
+		appendItem(commands, "{\"dueDay\":" + std::to_string(dueDay) + ",\"command\":" + cmd.serialize() + "}");
+	});
+
+	Memento::NurseryState state;
+	state.day = currentDay;
+	state.seed = seed;
+	state.inventory = snapshotRecorder->capture(*inventory);
+	state.commands = std::move(commands);
+	return new Memento(state);
+}
 
 void Nursery::restoreFromMemento(Memento* memento) { (void)memento; }
 
-void Nursery::spawnCustomer() { }
+void Nursery::spawnCustomer() {
+	// One draw of the customer stream per customer: the same seed brings the same customers.
+	const uint64_t draw = CounterRng(seed, kCustomerStream)(customersSpawned++);
+	static constexpr WaterLevel kWater[] = {LOW, MEDIUM, HIGH, HIGH};
+	static constexpr SunLevel kSun[] = {SHADE, PARTIAL, FULL, FULL};
+
+	specificationBuilder->reset();
+	specificationBuilder->setRequestType((draw & 3) == 0 ? RECOMMENDATION : PURCHASE);
+	specificationBuilder->setWaterRequirement(kWater[(draw >> 2) & 3]);
+	specificationBuilder->setSunRequirement(kSun[(draw >> 4) & 3]);
+	if (((draw >> 6) & 3) == 0 && !plantSpecies.empty()) {
+		const ComponentTypeId species = plantSpecies[(draw >> 8) % plantSpecies.size()];
+		specificationBuilder->setExplicitName(TypeRegistry::shared().info(species).name.str());
+	}
+	if (draw & (1ull << 16)) specificationBuilder->addDecorator("Pot");
+	if (draw & (1ull << 17)) specificationBuilder->addDecorator("Ribbon");
+	if ((draw & (7ull << 18)) == 0) specificationBuilder->addDecorator("GiftWrap");
+
+	auto customer = std::make_shared<Customer>();
+	activeCustomers.push_back(customer);
+	addRequest(std::make_unique<FulfillCustomerCommand>(
+		std::make_unique<PlantSpecification>(specificationBuilder->getResult()), inventory, customer));
+}
+
+void Nursery::processRequestQueue() {
+	drainRequestInbox();
+	std::vector<std::unique_ptr<Command>> overCapacity;
+	while (auto cmd = requestQueue.pop()) {
+		if (staffRouter.dispatch(cmd) == CommandRouter::Outcome::Deferred) overCapacity.push_back(std::move(cmd));
+	}
+	for (auto& cmd : overCapacity) requestQueue.schedule(std::move(cmd), static_cast<uint64_t>(currentDay) + 1);
+	// Every request of today's customers has been served; they leave with their purchases.
+	activeCustomers.clear();
+}
+
+void Nursery::hireStaff(const std::shared_ptr<Staff>& member) { staffRouter.addStaff(member); }
+
+void Nursery::setupNursery() {
+	inventory = std::make_shared<Inventory>();
+	snapshotRecorder = std::make_unique<SnapshotRecorder>();
+
+	hireStaff(std::make_shared<Gardener>());
+	hireStaff(std::make_shared<Cashier>());
+
+	const TypeRegistry& types = TypeRegistry::shared();
+	setPlantFactory(types.idOf(ComponentKind::Rose), std::make_shared<RoseFactory>());
+	setPlantFactory(types.idOf(ComponentKind::Cactus), std::make_shared<CactusFactory>());
+
+	specificationBuilder = std::make_unique<ConcretePlantSpecificationBuilder>();
+}
+
+void Nursery::tickPlants() {
+	if (tickUnitsVersion != InventoryComponent::topologyVersion()) rebuildTickUnits();
+
+	if (workers) {
+		workers->parallelFor(tickUnits.size(), [this](std::size_t index) { runTickUnit(tickUnits[index]); });
+	} else {
+		for (auto& unit : tickUnits) runTickUnit(unit);
+	}
+
+	lifecycleReport.clear();
+	for (const auto& unit : tickUnits) lifecycleReport += unit.counters;
+	assignPlotStates();
+	// Per-plant observers, in unit order whatever the thread count; an earlier callback may have removed a plant.
+	for (const auto& unit : tickUnits) {
+		for (const auto& entry : unit.observed) {
+			if (auto subject = entry.lock()) static_cast<Plant&>(*subject).notifyObservers();
+		}
+	}
+	publishPlantEvents();
+}
+
+void Nursery::assignPlotStates() {
+	// One report per plot instead of a rebuild of every Group's aggregates on the next query.
+	for (const auto& unit : tickUnits) {
+		if (unit.plot) unit.plot->assignPlantState(unit.plantState);
+	}
+}
+
+void Nursery::publishPlantEvents() {
+	// The batch is ordered by plant id whatever the thread count, and so are the commands raised from it.
+	std::vector<PendingRequest> raised;
+	{
+		// Stages this thread's submissions until delivery ends, also when an observer throws.
+		struct Staging {
+			Nursery& nursery;
+			Staging(Nursery& owner, std::vector<PendingRequest>& into) : nursery(owner) {
+				nursery.stagedRequests = &into;
+				nursery.stagingThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+			}
+			~Staging() {
+				nursery.stagingThread.store(std::thread::id(), std::memory_order_relaxed);
+				nursery.stagedRequests = nullptr;
+			}
+		} staging(*this, raised);
+		plantEvents.publish();
+	}
+	coalesceWaterings(raised);
+	for (auto& request : raised) {
+		requestQueue.schedule(std::move(request.command), static_cast<uint64_t>(currentDay) + request.daysAhead);
+	}
+}
+
+void Nursery::rebuildTickUnits() {
+	std::vector<TickUnit> units;
+	std::vector<SlotRef> looseSlots;
+	std::vector<SlotRef> plotSlots;
+	std::vector<PlantStore*> storeOrder;
+
+	auto collect = [&](Plant* plant, std::vector<SlotRef>& slots) {
+		PlantStore* store = plant->getStore().get();
+		auto found = std::find(storeOrder.begin(), storeOrder.end(), store);
+		if (found == storeOrder.end()) found = storeOrder.insert(storeOrder.end(), store);
+		slots.push_back({static_cast<std::size_t>(found - storeOrder.begin()), store, plant->getSlot()});
+	};
+	auto pushUnit = [&](Group* plot, std::vector<SlotRef>& slots) {
+		std::sort(slots.begin(), slots.end(), [](const SlotRef& a, const SlotRef& b) {
+			return a.storeRank != b.storeRank ? a.storeRank < b.storeRank : a.slot < b.slot;
+		});
+		TickUnit unit;
+		unit.streamId = plot ? plot->getId() : 0;
+		unit.plot = plot;
+		if (deferred) unit.syncedFrom = deferred->windowStart;
+		unit.slotCount = slots.size();
+		for (const auto& ref : slots) {
+			auto& runs = unit.runs;
+			if (!runs.empty() && runs.back().store == ref.store && runs.back().end == ref.slot) ++runs.back().end;
+			else runs.push_back({ref.store, storeIndexOf(ref.store), ref.slot, ref.slot + 1});
+		}
+		units.push_back(std::move(unit));
+	};
+
+	// Pre-order walk of the ownership tree: a plot's unit precedes the units of its nested plots.
+	// Views own nothing, so they have no children in the tree and produce no unit.
+	const ComponentTree& tree = ComponentTree::shared();
+	for (const auto& component : inventory->getComponents()) {
+		if (Plant* plant = plantOf(component.get())) {
+			collect(plant, looseSlots);
+			continue;
+		}
+		tree.forEachPreOrder(component->treeNode(), [&](ComponentTree::Handle node) {
+			auto group = dynamic_cast<Group*>(tree.component(node));
+			if (!group) return;
+			plotSlots.clear();
+			tree.forEachChild(node, [&](ComponentTree::Handle child) {
+				if (Plant* plant = plantOf(tree.component(child))) collect(plant, plotSlots);
+			});
+			if (!plotSlots.empty()) pushUnit(group, plotSlots);
+		});
+	}
+	if (!looseSlots.empty()) pushUnit(nullptr, looseSlots);
+
+	for (auto& slots : storeSlots) {
+		const std::size_t capacity = slots.store->capacity();
+		slots.units.resize(capacity, kNoUnit);
+		slots.dueDays.resize(capacity, 0);
+		slots.marks.resize(capacity, 0);
+	}
+	for (const auto& unit : tickUnits) {
+		for (const auto& run : unit.runs) {
+			std::fill(storeSlots[run.storeIndex].marks.begin() + run.begin,
+				storeSlots[run.storeIndex].marks.begin() + run.end, uint8_t{1});
+		}
+	}
+	// Plants that changed weather stream (or joined) re-solve their quiet days; a deferred one is
+	// first caught up under its old unit (tickUnits still holds the previous units here).
+	std::vector<std::pair<std::size_t, PlantStore::Slot>> regrouped;
+	const auto today = static_cast<uint32_t>(currentDay);
+	for (std::size_t index = 0; index < units.size(); ++index) {
+		for (const auto& run : units[index].runs) {
+			StoreSlots& slots = storeSlots[run.storeIndex];
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) {
+				slots.marks[slot] = 0; // still ticked
+				const uint32_t previous = slots.units[slot];
+				const bool sameStream = previous != kNoUnit && tickUnitsSeed == seed
+					&& tickUnits[previous].streamId == units[index].streamId;
+				if (!sameStream) {
+					if (deferred && previous != kNoUnit) {
+						deferred->catchUpRun(tickUnits[previous], {run.store, run.storeIndex, slot, slot + 1}, today);
+					}
+					run.store->forgetQuietDays(slot, slot + 1);
+					if (deferred) {
+						run.store->defer(slot, today);
+						regrouped.emplace_back(run.storeIndex, slot);
+					}
+				}
+				slots.units[slot] = static_cast<uint32_t>(index);
+			}
+		}
+	}
+	// Plants in no unit any more (sold, or moved out of the inventory) stop being ticked.
+	for (const auto& unit : tickUnits) {
+		for (const auto& run : unit.runs) {
+			StoreSlots& slots = storeSlots[run.storeIndex];
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot) {
+				if (!slots.marks[slot]) continue;
+				slots.marks[slot] = 0;
+				if (deferred) deferred->catchUpRun(unit, {run.store, run.storeIndex, slot, slot + 1}, today);
+				run.store->undefer(slot);
+				slots.units[slot] = kNoUnit;
+			}
+		}
+	}
+
+	if (deferred) {
+		// A plot keeps its window's weather; new plots compute theirs.
+		std::unordered_map<uint64_t, std::vector<int32_t>*> weather;
+		for (auto& unit : tickUnits) weather.emplace(unit.streamId, &unit.weatherPrefix);
+		const uint32_t days = deferred->windowEnd - deferred->windowStart;
+		for (auto& unit : units) {
+			auto found = weather.find(unit.streamId);
+			if (found != weather.end() && found->second->size() == static_cast<std::size_t>(days) + 1) {
+				unit.weatherPrefix = *found->second;
+			} else {
+				computeWeatherPrefix(unit, deferred->windowStart, days);
+			}
+		}
+	}
+	tickUnits = std::move(units);
+	tickUnitsVersion = InventoryComponent::topologyVersion();
+	tickUnitsSeed = seed;
+	for (const auto& [storeIndex, slot] : regrouped) scheduleDue(storeIndex, slot);
+}
+
+void Nursery::runTickUnit(TickUnit& unit) {
+	const int32_t extraWaterLoss = weatherLoss(unit.streamId, static_cast<uint64_t>(currentDay));
+
+	const bool recording = plantEvents.hasSubscribers();
+	if (recording) {
+		unit.priorStages.resize(unit.slotCount);
+		unit.priorWaterLevels.resize(unit.slotCount);
+		std::size_t index = 0;
+		for (const auto& run : unit.runs) {
+			for (PlantStore::Slot slot = run.begin; slot < run.end; ++slot, ++index) {
+				unit.priorStages[index] = static_cast<uint8_t>(run.store->stage(slot));
+				unit.priorWaterLevels[index] = run.store->waterLevel(slot);
+			}
+		}
+	}
 
-void Nursery::processRequestQueue() { }
+	unit.counters.clear();
+	unit.observed.clear();
+	unit.plantState = PlantStore::RangeState{};
+	for (const auto& run : unit.runs) {
+		run.store->tickRange(run.begin, run.end, extraWaterLoss, &unit.counters, &unit.plantState);
+	}
 
-void Nursery::setupNursery() { }
+	// Views are refreshed here (stateChanged() is safe from any unit). Observers attached to
+	// a plant run on the simulation thread once every unit is done (tickPlants()), and the
+	// supervisor gets the recorded events in one batch after that.
+	std::size_t offset = 0;
+	for (const auto& run : unit.runs) {
+		run.store->forEachEvent(run.begin, run.end, [&](Plant* plant, uint8_t events) {
+			Inventory::stateChanged(*plant);
+			if (plant->hasObservers()) unit.observed.push_back(plant->Subject::weak_from_this());
+			if (!recording) return;
+			const PlantStore::Slot slot = plant->getSlot();
+			const std::size_t index = offset + (slot - run.begin);
+			if (events & PlantStore::BecameThirsty) {
+				plantEvents.record({plant, plant->getId(), unit.priorWaterLevels[index], run.store->waterLevel(slot),
+					PlantEvent::Field::WaterLevel});
+			}
+			if (events & PlantStore::StageChanged) {
+				plantEvents.record({plant, plant->getId(), unit.priorStages[index], static_cast<int32_t>(run.store->stage(slot)),
+					PlantEvent::Field::Stage});
+			}
+		});
+		offset += run.end - run.begin;
+	}
+}
 
+const std::shared_ptr<NurserySupervisor>& Nursery::getSupervisor() {
+	if (!supervisor) {
+		supervisor = std::make_shared<NurserySupervisor>(shared_from_this());
+		plantEvents.subscribe(supervisor);
+	}
+	return supervisor;
+}
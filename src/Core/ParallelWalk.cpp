@@ -0,0 +1,88 @@
+#include "../../include/Core/ParallelWalk.h"
+#include "../../include/Core/Inventory.h"
+#include "../../include/Components/Group.h"
+
+#include <algorithm>
+
+namespace {
+
+// Chunks per walk when the tree is large enough: plenty to balance a few dozen cores.
+constexpr std::size_t kChunksPerWalk = 256;
+// Below this many components a chunk is not worth a task.
+constexpr std::size_t kMinChunkSize = 1024;
+
+// Estimated components in the owned subtree of 'node': owning groups know their plant count.
+std::size_t weightOf(const ComponentTree& tree, ComponentTree::Handle node) {
+	if (tree.firstChild(node) == ComponentTree::kNull) return 1;
+	auto group = dynamic_cast<const Group*>(tree.component(node));
+	return group && group->owns() ? 1 + static_cast<std::size_t>(group->getPlantCount()) : 1;
+}
+
+} // namespace
+
+ParallelWalk::ParallelWalk(const Inventory& inventory) {
+	std::vector<ComponentTree::Handle> roots;
+	roots.reserve(inventory.getComponents().size());
+	for (const auto& component : inventory.getComponents()) roots.push_back(component->treeNode());
+	plan(roots);
+}
+
+ParallelWalk::ParallelWalk(const InventoryComponent& root) { plan({root.treeNode()}); }
+
+void ParallelWalk::plan(const std::vector<ComponentTree::Handle>& roots) {
+	const ComponentTree& tree = ComponentTree::shared();
+	generation = tree.layoutGeneration();
+	std::size_t total = 0;
+	for (ComponentTree::Handle root : roots) total += weightOf(tree, root);
+	const std::size_t target = std::max(kMinChunkSize, total / kChunksPerWalk);
+
+	std::vector<Entry> chunk;
+	std::size_t chunkWeight = 0;
+	ComponentTree::Handle runEnd = ComponentTree::kNull; // last subtree of chunk.back() when it is a run
+	auto close = [&] {
+		if (chunkWeight < target) return;
+		chunks.push_back(std::move(chunk));
+		chunk.clear();
+		chunkWeight = 0;
+		runEnd = ComponentTree::kNull;
+	};
+	auto appendSubtree = [&](ComponentTree::Handle node, std::size_t weight) {
+		// Consecutive siblings (the plants of a large plot) share one entry.
+		if (runEnd != ComponentTree::kNull && tree.nextSibling(runEnd) == node) ++chunk.back().subtrees;
+		else chunk.push_back(Entry{node, 1});
+		runEnd = node;
+		chunkWeight += weight;
+		close();
+	};
+	auto appendNode = [&](ComponentTree::Handle node) {
+		chunk.push_back(Entry{node, 0});
+		runEnd = ComponentTree::kNull;
+		++chunkWeight;
+		close();
+	};
+
+	// Pre-order over the nodes still to plan; subtrees that fit a chunk are taken whole.
+	// Each cursor is the next node to plan at its depth and whether its siblings follow it.
+	struct Cursor {
+		ComponentTree::Handle node;
+		bool siblings;
+	};
+	std::vector<Cursor> pending;
+	for (auto root = roots.rbegin(); root != roots.rend(); ++root) pending.push_back(Cursor{*root, false});
+	while (!pending.empty()) {
+		Cursor& cursor = pending.back();
+		const ComponentTree::Handle node = cursor.node;
+		const ComponentTree::Handle next = cursor.siblings ? tree.nextSibling(node) : ComponentTree::kNull;
+		if (next != ComponentTree::kNull) cursor.node = next;
+		else pending.pop_back();
+
+		const std::size_t weight = weightOf(tree, node);
+		if (weight <= target) {
+			appendSubtree(node, weight);
+			continue;
+		}
+		appendNode(node);
+		pending.push_back(Cursor{tree.firstChild(node), true});
+	}
+	if (!chunk.empty()) chunks.push_back(std::move(chunk));
+}
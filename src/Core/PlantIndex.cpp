@@ -0,0 +1,84 @@
+#include "../../include/Core/PlantIndex.h"
+#include "../../include/Core/Inventory.h"
+#include "../../include/Components/ComponentTree.h"
+#include "../../include/Components/Plant.h"
+
+namespace {
+
+std::size_t cellOf(WaterLevel water, SunLevel sun) {
+	return static_cast<std::size_t>(water) * 3 + static_cast<std::size_t>(sun);
+}
+
+} // namespace
+
+void PlantIndex::addSubtree(const InventoryComponent& root) {
+	const ComponentTree& tree = ComponentTree::shared();
+	tree.forEachPreOrder(root.treeNode(), [&](ComponentTree::Handle node) {
+		if (auto* plant = dynamic_cast<Plant*>(tree.component(node))) add(*plant);
+	});
+}
+
+void PlantIndex::removeSubtree(const InventoryComponent& root) {
+	if (entries == 0) return;
+	const ComponentTree& tree = ComponentTree::shared();
+	tree.forEachPreOrder(root.treeNode(), [&](ComponentTree::Handle node) {
+		if (const auto* plant = dynamic_cast<const Plant*>(tree.component(node))) remove(*plant);
+	});
+}
+
+PlantIndex::Bucket& PlantIndex::bucketOf(const Plant& plant) {
+	return cells[cellOf(plant.getWaterRequirement(), plant.getSunRequirement())].byName[plant.getNameSymbol()];
+}
+
+void PlantIndex::add(Plant& plant) {
+	if (plant.getStage() == LifecycleStage::Withered) return;
+	entries += bucketOf(plant).emplace(plant.markStocked(), plant.getId()).second;
+}
+
+void PlantIndex::remove(const Plant& plant) {
+	// Unstocked plants were never indexed; a withered one may already be gone.
+	if (plant.getStockSequence() == 0) return;
+	entries -= bucketOf(plant).erase(plant.getStockSequence());
+}
+
+std::shared_ptr<Plant> PlantIndex::front(const Inventory& within, Bucket& bucket, WaterLevel water, SunLevel sun) {
+	while (!bucket.empty()) {
+		const auto [sequence, id] = *bucket.begin();
+		auto plant = Plant::resolve(id);
+		// The id may since belong to another plant (setId()); recheck the entry's sequence and attributes too.
+		if (plant && plant->getStockSequence() == sequence && plant->getStage() != LifecycleStage::Withered
+			&& plant->getWaterRequirement() == water && plant->getSunRequirement() == sun && within.contains(*plant)) {
+			return plant;
+		}
+		bucket.erase(bucket.begin());
+		--entries;
+	}
+	return nullptr;
+}
+
+std::shared_ptr<Plant> PlantIndex::findAvailable(const Inventory& within, WaterLevel maxWater, SunLevel maxSun,
+	const std::string& name) {
+	// A name nobody ever interned belongs to no plant.
+	Symbol wanted;
+	if (!Symbol::lookup(name, wanted)) return nullptr;
+	std::shared_ptr<Plant> best;
+	const auto consider = [&best](std::shared_ptr<Plant> candidate) {
+		if (candidate && (!best || candidate->getStockSequence() < best->getStockSequence())) best = std::move(candidate);
+	};
+	for (int water = LOW; water <= maxWater; ++water) {
+		for (int sun = SHADE; sun <= maxSun; ++sun) {
+			Cell& cell = cells[cellOf(static_cast<WaterLevel>(water), static_cast<SunLevel>(sun))];
+			if (!wanted.empty()) {
+				auto bucket = cell.byName.find(wanted);
+				if (bucket != cell.byName.end()) {
+					consider(front(within, bucket->second, static_cast<WaterLevel>(water), static_cast<SunLevel>(sun)));
+				}
+				continue;
+			}
+			for (auto& entry : cell.byName) {
+				consider(front(within, entry.second, static_cast<WaterLevel>(water), static_cast<SunLevel>(sun)));
+			}
+		}
+	}
+	return best;
+}
@@ -2,13 +2,33 @@
 #include "../../include/Patterns/Memento/Memento.h"
 #include "../../include/Core/Nursery.h"
 
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
 SaveSystem::SaveSystem() = default;
 
 void SaveSystem::save(const std::shared_ptr<Nursery>& nursery, const std::string& filename) {
-	(void)nursery; (void)filename; // stub
+	if (!nursery) return;
+	const std::unique_ptr<Memento> memento(nursery->createMemento());
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if (!out) throw std::runtime_error("SaveSystem: cannot open '" + filename + "' for writing");
+	out << memento->serialize();
+	if (!out) throw std::runtime_error("SaveSystem: failed writing '" + filename + "'");
 }
 
 std::unique_ptr<Memento> SaveSystem::load(const std::string& filename) {
-	(void)filename; return nullptr;
-}
+	std::ifstream in(filename, std::ios::binary);
+	if (!in) throw std::runtime_error("SaveSystem: cannot open '" + filename + "'");
+	std::ostringstream buffer;
+	buffer << in.rdbuf();
 
+	Memento::NurseryState state;
+	state.serializedData = buffer.str();
+	// The day is the first field of every snapshot; the rest is for Nursery to interpret.
+	const auto key = state.serializedData.find("\"day\":");
+	if (key == std::string::npos) throw std::runtime_error("SaveSystem: '" + filename + "' is not a nursery snapshot");
+	state.day = std::atoi(state.serializedData.c_str() + key + 6);
+	return std::make_unique<Memento>(state);
+}
@@ -0,0 +1,82 @@
+#include "../../include/Core/SlabPool.h"
+
+#include <algorithm>
+
+namespace {
+
+std::size_t roundUp(std::size_t value, std::size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+} // namespace
+
+SlabPool::SlabPool(std::size_t slabBlocks) : blocksPerSlab(std::max<std::size_t>(1, slabBlocks)) {}
+
+SlabPool::~SlabPool() {
+	for (unsigned char* slab : slabs) ::operator delete(slab, std::align_val_t(blockAlignment));
+}
+
+void* SlabPool::allocate(std::size_t bytes, std::size_t alignment) {
+	std::lock_guard<std::mutex> lock(mutex);
+	++counters.allocations;
+	if (blockSize == 0) {
+		blockAlignment = std::max(alignment, alignof(FreeBlock));
+		blockSize = roundUp(std::max(bytes, sizeof(FreeBlock)), blockAlignment);
+	}
+	if (roundUp(std::max(bytes, sizeof(FreeBlock)), blockAlignment) != blockSize) {
+		// deallocate() only learns the size, so fallbacks use the default alignment.
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) throw std::bad_alloc();
+		++counters.fallbacks;
+		return ::operator new(bytes);
+	}
+	++counters.liveBlocks;
+	if (freeList) {
+		FreeBlock* block = freeList;
+		freeList = block->next;
+		--freeCount;
+		++counters.reused;
+		return block;
+	}
+	if (cursor == slabEnd) newSlab(blocksPerSlab);
+	void* block = cursor;
+	cursor += blockSize;
+	++counters.carved;
+	return block;
+}
+
+void SlabPool::deallocate(void* block, std::size_t bytes) noexcept {
+	if (!block) return;
+	std::lock_guard<std::mutex> lock(mutex);
+	if (blockSize == 0 || roundUp(std::max(bytes, sizeof(FreeBlock)), blockAlignment) != blockSize) {
+		::operator delete(block);
+		return;
+	}
+	--counters.liveBlocks;
+	freeList = new (block) FreeBlock{freeList};
+	++freeCount;
+}
+
+void SlabPool::reserve(std::size_t count) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (blockSize == 0) return;
+	const std::size_t available = freeCount + static_cast<std::size_t>(slabEnd - cursor) / blockSize;
+	if (count > available) newSlab(std::max(count - available, blocksPerSlab));
+}
+
+void SlabPool::newSlab(std::size_t blocks) {
+	for (; cursor != slabEnd; cursor += blockSize) {
+		freeList = new (cursor) FreeBlock{freeList};
+		++freeCount;
+	}
+	const std::size_t bytes = blocks * blockSize;
+	cursor = static_cast<unsigned char*>(::operator new(bytes, std::align_val_t(blockAlignment)));
+	slabEnd = cursor + bytes;
+	slabs.push_back(cursor);
+	++counters.slabs;
+	counters.bytesReserved += bytes;
+}
+
+SlabPool::Stats SlabPool::stats() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	Stats snapshot = counters;
+	snapshot.blockSize = blockSize;
+	return snapshot;
+}
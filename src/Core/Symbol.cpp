@@ -0,0 +1,51 @@
+#include "../../include/Core/Symbol.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+struct SymbolTable {
+	std::mutex mutex;
+	// Keys view the interned strings themselves.
+	std::unordered_map<std::string_view, const std::string*> entries;
+};
+
+// Leaked on purpose: Symbols held by static objects may be read during shutdown.
+SymbolTable& table() {
+	static SymbolTable* instance = new SymbolTable();
+	return *instance;
+}
+
+} // namespace
+
+Symbol::Symbol(std::string_view text) {
+	if (text.empty()) return;
+	SymbolTable& symbols = table();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	auto found = symbols.entries.find(text);
+	if (found == symbols.entries.end()) {
+		const std::string* interned = new std::string(text);
+		found = symbols.entries.emplace(std::string_view(*interned), interned).first;
+	}
+	this->text = found->second;
+}
+
+bool Symbol::lookup(std::string_view text, Symbol& symbol) {
+	if (text.empty()) {
+		symbol = Symbol();
+		return true;
+	}
+	SymbolTable& symbols = table();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	auto found = symbols.entries.find(text);
+	if (found == symbols.entries.end()) return false;
+	symbol.text = found->second;
+	return true;
+}
+
+std::size_t Symbol::internedCount() {
+	SymbolTable& symbols = table();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	return symbols.entries.size();
+}
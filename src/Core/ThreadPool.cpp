@@ -0,0 +1,100 @@
+#include "../../include/Core/ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+	if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+	if (threadCount == 0) threadCount = 1;
+	for (unsigned i = 0; i < threadCount; ++i) queues.push_back(std::make_unique<WorkQueue>());
+	// Participant 0 is the thread calling parallelFor(); the rest get a worker thread.
+	for (unsigned i = 1; i < threadCount; ++i) workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(batchMutex);
+		stopping = true;
+	}
+	batchReady.notify_all();
+	for (auto& worker : workers) worker.join();
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+	if (count == 0) return;
+	if (workers.empty() || count == 1) {
+		for (std::size_t i = 0; i < count; ++i) task(i);
+		return;
+	}
+
+	const std::size_t participants = queues.size();
+	for (std::size_t i = 0; i < count; ++i) {
+		WorkQueue& queue = *queues[i % participants];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.items.push_back(i);
+	}
+	firstError = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(batchMutex);
+		currentTask = &task;
+		activeWorkers = static_cast<unsigned>(workers.size());
+		++generation;
+	}
+	batchReady.notify_all();
+
+	runBatch(0);
+
+	{
+		// Workers may still be finishing stolen items; wait until every one has left the batch.
+		std::unique_lock<std::mutex> lock(batchMutex);
+		batchDone.wait(lock, [this] { return activeWorkers == 0; });
+		currentTask = nullptr;
+	}
+	if (firstError) std::rethrow_exception(firstError);
+}
+
+bool ThreadPool::takeWork(unsigned participant, std::size_t& index) {
+	{
+		WorkQueue& own = *queues[participant];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.items.empty()) {
+			index = own.items.front();
+			own.items.pop_front();
+			return true;
+		}
+	}
+	const unsigned participants = size();
+	for (unsigned offset = 1; offset < participants; ++offset) {
+		WorkQueue& victim = *queues[(participant + offset) % participants];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.items.empty()) {
+			index = victim.items.back();
+			victim.items.pop_back();
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::runBatch(unsigned participant) {
+	std::size_t index;
+	while (takeWork(participant, index)) {
+		try {
+			(*currentTask)(index);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(errorMutex);
+			if (!firstError) firstError = std::current_exception();
+		}
+	}
+}
+
+void ThreadPool::workerLoop(unsigned participant) {
+	uint64_t seenGeneration = 0;
+	std::unique_lock<std::mutex> lock(batchMutex);
+	for (;;) {
+		batchReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+		if (stopping) return;
+		seenGeneration = generation;
+		lock.unlock();
+		runBatch(participant);
+		lock.lock();
+		if (--activeWorkers == 0) batchDone.notify_all();
+	}
+}
@@ -5,11 +5,11 @@ ConcretePlantSpecificationBuilder::ConcretePlantSpecificationBuilder() = default
 // Provide the default constructor for PlantSpecification used by reset()/getResult().
 PlantSpecification::PlantSpecification() : waterReq(LOW), sunReq(PARTIAL), requestType(RECOMMENDATION), explicitName() {}
 
-void ConcretePlantSpecificationBuilder::setWaterRequirement(WaterLevel level) { (void)level; }
-void ConcretePlantSpecificationBuilder::setSunRequirement(SunLevel level) { (void)level; }
-void ConcretePlantSpecificationBuilder::addDecorator(const std::string& decorator) { (void)decorator; }
-void ConcretePlantSpecificationBuilder::setRequestType(RequestType type) { (void)type; }
-void ConcretePlantSpecificationBuilder::setExplicitName(const std::string& name) { (void)name; }
+void ConcretePlantSpecificationBuilder::setWaterRequirement(WaterLevel level) { specification.waterReq = level; }
+void ConcretePlantSpecificationBuilder::setSunRequirement(SunLevel level) { specification.sunReq = level; }
+void ConcretePlantSpecificationBuilder::addDecorator(const std::string& decorator) { specification.decorators.push_back(decorator); }
+void ConcretePlantSpecificationBuilder::setRequestType(RequestType type) { specification.requestType = type; }
+void ConcretePlantSpecificationBuilder::setExplicitName(const std::string& name) { specification.explicitName = name; }
 PlantSpecification ConcretePlantSpecificationBuilder::getResult() { return specification; }
 void ConcretePlantSpecificationBuilder::reset() { specification = PlantSpecification(); }
 
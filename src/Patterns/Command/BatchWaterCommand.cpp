@@ -0,0 +1,123 @@
+#include "../../../include/Patterns/Command/BatchWaterCommand.h"
+#include "../../../include/Patterns/Command/WaterPlantCommand.h"
+#include "../../../include/Components/Group.h"
+#include "../../../include/Components/Rose.h"
+#include "../../../include/Components/Cactus.h"
+#include "../../../include/Core/Json.h"
+
+#include <algorithm>
+
+namespace {
+
+// Locks the live targets of one species and waters them in a single non-virtual loop.
+template <typename Species>
+std::size_t waterSpecies(const std::vector<std::weak_ptr<Species>>& targets) {
+	std::vector<std::shared_ptr<Species>> alive;
+	std::vector<Species*> plants;
+	alive.reserve(targets.size());
+	plants.reserve(targets.size());
+	for (const auto& target : targets) {
+		if (auto plant = target.lock()) {
+			plants.push_back(plant.get());
+			alive.push_back(std::move(plant));
+		}
+	}
+	Species::waterAll(plants.data(), plants.size());
+	return plants.size();
+}
+
+template <typename Species, typename Fn>
+void forEachLive(const std::vector<std::weak_ptr<Species>>& targets, Fn&& fn) {
+	for (const auto& target : targets) {
+		if (auto plant = target.lock()) fn(*plant);
+	}
+}
+
+template <typename Species>
+void appendLive(const std::vector<std::weak_ptr<Species>>& targets, std::vector<std::shared_ptr<Plant>>& out) {
+	for (const auto& target : targets) {
+		if (auto plant = target.lock()) out.push_back(std::move(plant));
+	}
+}
+
+} // namespace
+
+BatchWaterCommand::BatchWaterCommand(const std::shared_ptr<Group>& plot, const std::vector<std::shared_ptr<Plant>>& plants)
+	: plot(plot), targetId(plot ? plot->getId() : 0), plotMergeKey(WaterPlantCommand::plotKey(plot.get())),
+	  status(Status::Pending) {
+	addPlants(plants);
+}
+
+void BatchWaterCommand::addPlants(const std::vector<std::shared_ptr<Plant>>& plants) {
+	const std::size_t known = memberIds.size();
+	for (const auto& plant : plants) {
+		if (!plant) continue;
+		const uint64_t id = plant->getId();
+		if (std::binary_search(memberIds.begin(), memberIds.begin() + static_cast<std::ptrdiff_t>(known), id)) continue;
+		memberIds.push_back(id);
+		if (auto rose = std::dynamic_pointer_cast<Rose>(plant)) roses.push_back(rose);
+		else if (auto cactus = std::dynamic_pointer_cast<Cactus>(plant)) cacti.push_back(cactus);
+		else others.push_back(plant);
+	}
+	const auto added = memberIds.begin() + static_cast<std::ptrdiff_t>(known);
+	std::sort(added, memberIds.end());
+	std::inplace_merge(memberIds.begin(), added, memberIds.end());
+}
+
+bool BatchWaterCommand::absorb(Command& later) {
+	std::vector<std::shared_ptr<Plant>> plants;
+	if (later.kind() == Kind::WaterPlant) {
+		auto plant = static_cast<WaterPlantCommand&>(later).getTarget();
+		if (!plant) return false; // an expired watering fails on its own, as it would unmerged
+		plants.push_back(std::move(plant));
+	} else if (later.kind() == Kind::BatchWater) {
+		const auto& batch = static_cast<BatchWaterCommand&>(later);
+		plants.reserve(batch.size());
+		appendLive(batch.roses, plants);
+		appendLive(batch.cacti, plants);
+		appendLive(batch.others, plants);
+	} else {
+		return false;
+	}
+	addPlants(plants);
+	return true;
+}
+
+void BatchWaterCommand::execute() {
+	std::size_t watered = waterSpecies(roses) + waterSpecies(cacti);
+	forEachLive(others, [&watered](Plant& plant) {
+		plant.water();
+		++watered;
+	});
+	status = watered ? Status::Completed : Status::Failed;
+}
+
+const char* BatchWaterCommand::typeName() const noexcept { return "BatchWaterCommand"; }
+
+int BatchWaterCommand::urgency() const {
+	int most = 0;
+	const auto consider = [&most](const Plant& plant) { most = std::max(most, WaterPlantCommand::urgencyOf(plant)); };
+	forEachLive(roses, consider);
+	forEachLive(cacti, consider);
+	forEachLive(others, consider);
+	return most;
+}
+
+std::string BatchWaterCommand::serialize() const {
+	std::string plants;
+	const auto append = [&plants](const Plant& plant) {
+		if (!plants.empty()) plants += ',';
+		plants += std::to_string(plant.getId());
+	};
+	forEachLive(roses, append);
+	forEachLive(cacti, append);
+	forEachLive(others, append);
+	return "{\"type\":" + Json::quote(typeName()) + ",\"status\":" + Json::quote(statusName(status))
+		+ ",\"targetId\":" + std::to_string(targetId) + ",\"payload\":{\"plants\":[" + plants + "]}}";
+}
+
+void BatchWaterCommand::deserialize(const std::string& data) { (void)data; }
+BatchWaterCommand::Status BatchWaterCommand::getStatus() const { return status; }
+void BatchWaterCommand::setStatus(Status s) { status = s; }
+uint64_t BatchWaterCommand::getTargetId() const { return targetId; }
+void BatchWaterCommand::setTargetId(uint64_t id) { targetId = id; }
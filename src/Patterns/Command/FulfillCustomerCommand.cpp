@@ -1,20 +1,88 @@
 #include "../../../include/Patterns/Command/FulfillCustomerCommand.h"
 #include "../../../include/Patterns/Builder/PlantSpecification.h"
+#include "../../../include/Patterns/Decorator/DecoratedItem.h"
+#include "../../../include/Components/Group.h"
+#include "../../../include/Components/Plant.h"
+#include "../../../include/Core/Inventory.h"
+#include "../../../include/Core/Json.h"
+#include "../../../include/Actors/Customer.h"
 #include <utility>
 
+namespace {
+
+// Wraps 'item' in one DecoratedItem carrying the named add-ons; unknown names are skipped.
+std::shared_ptr<InventoryComponent> decorate(std::shared_ptr<InventoryComponent> item, const std::vector<std::string>& names) {
+	std::shared_ptr<DecoratedItem> decorated;
+	for (const auto& name : names) {
+		DecoratedItem::AddOn addOn;
+		if (!DecoratedItem::parseAddOn(name, addOn)) continue;
+		if (!decorated || decorated->addOnCount() == DecoratedItem::kMaxAddOns) {
+			decorated = std::make_shared<DecoratedItem>(decorated ? decorated : item);
+		}
+		decorated->addOn(addOn);
+	}
+	if (decorated) item = std::move(decorated);
+	return item;
+}
+
+} // namespace
+
 FulfillCustomerCommand::FulfillCustomerCommand(std::unique_ptr<PlantSpecification> spec,
 	const std::shared_ptr<Inventory>& inventory,
 	const std::shared_ptr<Customer>& customer)
-{
-	(void)spec; (void)inventory; (void)customer;
+	: spec(std::move(spec)), inventory(inventory), customer(customer), targetId(0), status(Status::Pending) {}
+
+void FulfillCustomerCommand::execute() {
+	auto buyer = customer.lock();
+	if (!buyer) {
+		status = Status::Cancelled; // the customer left before being served
+		return;
+	}
+	auto stock = inventory.lock();
+	if (!stock || !spec) {
+		status = Status::Failed;
+		return;
+	}
+
+	auto found = stock->findAvailable(spec->waterReq, spec->sunReq, spec->explicitName);
+	if (!found) {
+		status = Status::Failed;
+		return;
+	}
+	targetId = found->getId();
+
+	if (spec->requestType == PURCHASE) {
+		// Sold plants leave the nursery: no owner, no supervisor.
+		if (auto owner = found->getOwner()) owner->remove(found);
+		else stock->remove(found);
+		found->detachAllObservers();
+		found->setWatched(false);
+
+		buyer->receive(decorate(found, spec->decorators));
+	}
+	status = Status::Completed;
 }
 
-void FulfillCustomerCommand::execute() { }
+const char* FulfillCustomerCommand::typeName() const noexcept { return "FulfillCustomerCommand"; }
 
-std::string FulfillCustomerCommand::serialize() const { return std::string(); }
-void FulfillCustomerCommand::deserialize(const std::string& data) { (void)data; }
-FulfillCustomerCommand::Status FulfillCustomerCommand::getStatus() const { return Status::Pending; }
-void FulfillCustomerCommand::setStatus(Status s) { (void)s; }
-uint64_t FulfillCustomerCommand::getTargetId() const { return 0; }
-void FulfillCustomerCommand::setTargetId(uint64_t id) { (void)id; }
+std::string FulfillCustomerCommand::serialize() const {
+	std::string out = "{\"type\":" + Json::quote(typeName()) + ",\"status\":" + Json::quote(statusName(status))
+		+ ",\"targetId\":" + std::to_string(targetId) + ",\"payload\":{";
+	if (spec) {
+		out += "\"water\":" + std::to_string(spec->waterReq) + ",\"sun\":" + std::to_string(spec->sunReq)
+			+ ",\"request\":" + std::to_string(spec->requestType) + ",\"name\":" + Json::quote(spec->explicitName)
+			+ ",\"decorators\":[";
+		for (std::size_t i = 0; i < spec->decorators.size(); ++i) {
+			if (i) out += ',';
+			out += Json::quote(spec->decorators[i]);
+		}
+		out += ']';
+	}
+	return out + "}}";
+}
 
+void FulfillCustomerCommand::deserialize(const std::string& data) { (void)data; }
+FulfillCustomerCommand::Status FulfillCustomerCommand::getStatus() const { return status; }
+void FulfillCustomerCommand::setStatus(Status s) { status = s; }
+uint64_t FulfillCustomerCommand::getTargetId() const { return targetId; }
+void FulfillCustomerCommand::setTargetId(uint64_t id) { targetId = id; }
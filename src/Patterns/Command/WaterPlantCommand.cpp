@@ -1,13 +1,65 @@
 #include "../../../include/Patterns/Command/WaterPlantCommand.h"
+#include "../../../include/Components/Plant.h"
+#include "../../../include/Components/Group.h"
+#include "../../../include/Core/Json.h"
 
-WaterPlantCommand::WaterPlantCommand(const std::shared_ptr<Plant>& plant) { (void)plant; }
+#include <algorithm>
 
-void WaterPlantCommand::execute() { }
+WaterPlantCommand::WaterPlantCommand(const std::shared_ptr<Plant>& plant)
+	: targetPlant(plant), targetId(plant ? plant->getId() : 0), status(Status::Pending) {}
 
-std::string WaterPlantCommand::serialize() const { return std::string(); }
-void WaterPlantCommand::deserialize(const std::string& data) { (void)data; }
-WaterPlantCommand::Status WaterPlantCommand::getStatus() const { return Status::Pending; }
-void WaterPlantCommand::setStatus(Status s) { (void)s; }
-uint64_t WaterPlantCommand::getTargetId() const { return 0; }
-void WaterPlantCommand::setTargetId(uint64_t id) { (void)id; }
+void WaterPlantCommand::execute() {
+	auto plant = targetPlant.lock();
+	if (!plant) {
+		status = Status::Failed;
+		return;
+	}
+	plant->water();
+	status = Status::Completed;
+}
+
+const char* WaterPlantCommand::typeName() const noexcept { return "WaterPlantCommand"; }
+
+int WaterPlantCommand::urgency() const {
+	auto plant = targetPlant.lock();
+	return plant ? urgencyOf(*plant) : 0;
+}
+
+uint64_t WaterPlantCommand::mergeKey() const {
+	auto plant = targetPlant.lock();
+	if (!plant) return 0;
+	// A top-level plant's waterings only merge with each other: a shared key would make every
+	// one try (and fail) to merge into the last. Plants and plots draw ids from one sequence.
+	const auto owner = plant->getOwner();
+	return owner ? plotKey(owner.get()) : plant->getId() + 1;
+}
 
+bool WaterPlantCommand::absorb(Command& later) {
+	if (later.kind() != Kind::WaterPlant) return false;
+	auto plant = targetPlant.lock();
+	return plant && plant == static_cast<WaterPlantCommand&>(later).getTarget();
+}
+
+uint64_t WaterPlantCommand::plotKey(const Group* plot) noexcept {
+	// Ids start at 1, so plots never take key 1 or the "no merging" 0.
+	return plot ? plot->getId() + 1 : 1;
+}
+
+int WaterPlantCommand::urgencyOf(const Plant& plant) {
+	return (LifecycleRules::kMaxLevel - plant.getHealth())
+		+ std::max(0, LifecycleRules::kThirstyThreshold - plant.getWaterLevel());
+}
+
+std::string WaterPlantCommand::serialize() const {
+	return "{\"type\":" + Json::quote(typeName()) + ",\"status\":" + Json::quote(statusName(status))
+		+ ",\"targetId\":" + std::to_string(targetId) + ",\"payload\":{}}";
+}
+void WaterPlantCommand::deserialize(const std::string& data) { (void)data; }
+WaterPlantCommand::Status WaterPlantCommand::getStatus() const { return status; }
+void WaterPlantCommand::setStatus(Status s) { status = s; }
+uint64_t WaterPlantCommand::getTargetId() const { return targetId; }
+void WaterPlantCommand::setTargetId(uint64_t id) {
+	// Rebind to the live plant carrying the id, e.g. when a restored command names its target by id.
+	if (id != targetId) targetPlant = Plant::resolve(id);
+	targetId = id;
+}
@@ -0,0 +1,77 @@
+#include "../../../include/Patterns/Decorator/DecoratedItem.h"
+#include "../../../include/Patterns/Decorator/GiftWrapDecorator.h"
+#include "../../../include/Patterns/Decorator/PotDecorator.h"
+#include "../../../include/Patterns/Decorator/RibbonDecorator.h"
+#include "../../../include/Core/Json.h"
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+struct AddOnRule {
+	const char* name;
+	double surcharge;
+	const char* suffix;
+};
+
+// Indexed by DecoratedItem::AddOn; the numbers are the matching decorators' own.
+constexpr AddOnRule kAddOnRules[] = {
+	{"Pot", PotDecorator::kSurcharge, PotDecorator::kSuffix},
+	{"Ribbon", RibbonDecorator::kSurcharge, RibbonDecorator::kSuffix},
+	{"GiftWrap", GiftWrapDecorator::kSurcharge, GiftWrapDecorator::kSuffix},
+};
+
+const AddOnRule& ruleOf(DecoratedItem::AddOn addOn) { return kAddOnRules[static_cast<std::size_t>(addOn)]; }
+
+} // namespace
+
+DecoratedItem::DecoratedItem(const std::shared_ptr<InventoryComponent>& component, std::initializer_list<AddOn> addOns)
+	: PlantDecorator(component), price(PlantDecorator::getPrice()) {
+	kind_ = ComponentKind::DecoratedItem;
+	for (AddOn each : addOns) addOn(each);
+}
+
+void DecoratedItem::addOn(AddOn addOn) {
+	if (count == kMaxAddOns) throw std::length_error("DecoratedItem: too many add-ons");
+	addOns[count++] = addOn;
+	price += ruleOf(addOn).surcharge;
+	appendToName(ruleOf(addOn).suffix);
+	markChanged();
+}
+
+std::shared_ptr<InventoryComponent> DecoratedItem::clone() const {
+	auto copy = std::make_shared<DecoratedItem>(wrappedComponent ? wrappedComponent->clone() : nullptr);
+	for (std::size_t i = 0; i < count; ++i) copy->addOn(addOns[i]);
+	copy->shareId(getId());
+	return copy;
+}
+
+std::shared_ptr<InventoryComponent> DecoratedItem::blueprintClone() const {
+	auto copy = std::make_shared<DecoratedItem>(wrappedComponent ? wrappedComponent->blueprintClone() : nullptr);
+	for (std::size_t i = 0; i < count; ++i) copy->addOn(addOns[i]);
+	return copy;
+}
+
+std::string DecoratedItem::serialize() const {
+	std::string out = "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId()) + ",\"data\":{\"addOns\":[";
+	for (std::size_t i = 0; i < count; ++i) {
+		if (i) out += ',';
+		out += Json::quote(addOnName(addOns[i]));
+	}
+	return out + "],\"wrapped\":" + (wrappedComponent ? wrappedComponent->serialize() : "null") + "}}";
+}
+
+void DecoratedItem::deserialize(const std::string& data) { (void)data; }
+std::string_view DecoratedItem::typeNameView() const { return "DecoratedItem"; }
+
+const char* DecoratedItem::addOnName(AddOn addOn) noexcept { return ruleOf(addOn).name; }
+
+bool DecoratedItem::parseAddOn(const std::string& text, AddOn& addOn) noexcept {
+	for (std::size_t i = 0; i < std::size(kAddOnRules); ++i) {
+		if (text == kAddOnRules[i].name) {
+			addOn = static_cast<AddOn>(i);
+			return true;
+		}
+	}
+	return false;
+}
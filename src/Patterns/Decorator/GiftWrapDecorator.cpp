@@ -1,12 +1,22 @@
 #include "../../../include/Patterns/Decorator/GiftWrapDecorator.h"
+#include "../../../include/Core/Json.h"
 
 GiftWrapDecorator::GiftWrapDecorator(const std::shared_ptr<InventoryComponent>& component)
-	: PlantDecorator(component) {}
+	: PlantDecorator(component) {
+	kind_ = ComponentKind::GiftWrapDecorator;
+	appendToName(kSuffix);
+}
 
-std::string GiftWrapDecorator::getName() const { return wrappedComponent ? wrappedComponent->getName() : std::string(); }
-double GiftWrapDecorator::getPrice() const { return wrappedComponent ? wrappedComponent->getPrice() : 0.0; }
-std::shared_ptr<InventoryComponent> GiftWrapDecorator::blueprintClone() const { return nullptr; }
-std::string GiftWrapDecorator::serialize() const { return std::string(); }
-void GiftWrapDecorator::deserialize(const std::string& data) { (void)data; }
-std::string GiftWrapDecorator::typeName() const { return "GiftWrapDecorator"; }
+double GiftWrapDecorator::getPrice() const { return PlantDecorator::getPrice() + kSurcharge; }
+
+std::shared_ptr<InventoryComponent> GiftWrapDecorator::blueprintClone() const {
+	return std::make_shared<GiftWrapDecorator>(wrappedComponent ? wrappedComponent->blueprintClone() : nullptr);
+}
 
+std::string GiftWrapDecorator::serialize() const {
+	return "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId())
+		+ ",\"data\":{\"wrapped\":" + (wrappedComponent ? wrappedComponent->serialize() : "null") + "}}";
+}
+
+void GiftWrapDecorator::deserialize(const std::string& data) { (void)data; }
+std::string_view GiftWrapDecorator::typeNameView() const { return "GiftWrapDecorator"; }
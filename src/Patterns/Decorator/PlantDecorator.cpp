@@ -2,12 +2,12 @@
 #include "../../../include/Patterns/Iterator/Iterator.h"
 
 PlantDecorator::PlantDecorator(const std::shared_ptr<InventoryComponent>& component)
-    : wrappedComponent(component) {}
-
-std::string PlantDecorator::getName() const {
-    return wrappedComponent ? wrappedComponent->getName() : std::string();
+    : wrappedComponent(component), name(component ? component->nameView() : std::string_view()) {
+    kind_ = ComponentKind::PlantDecorator;
 }
 
+void PlantDecorator::appendToName(std::string_view suffix) { name += suffix; }
+
 double PlantDecorator::getPrice() const {
     return wrappedComponent ? wrappedComponent->getPrice() : 0.0;
 }
@@ -32,4 +32,4 @@ void PlantDecorator::deserialize(const std::string& data) {
     if (wrappedComponent) wrappedComponent->deserialize(data);
 }
 
-std::string PlantDecorator::typeName() const { return "PlantDecorator"; }
+std::string_view PlantDecorator::typeNameView() const { return "PlantDecorator"; }
@@ -1,12 +1,22 @@
 #include "../../../include/Patterns/Decorator/PotDecorator.h"
+#include "../../../include/Core/Json.h"
 
 PotDecorator::PotDecorator(const std::shared_ptr<InventoryComponent>& component)
-	: PlantDecorator(component) {}
+	: PlantDecorator(component) {
+	kind_ = ComponentKind::PotDecorator;
+	appendToName(kSuffix);
+}
 
-std::string PotDecorator::getName() const { return wrappedComponent ? wrappedComponent->getName() : std::string(); }
-double PotDecorator::getPrice() const { return wrappedComponent ? wrappedComponent->getPrice() : 0.0; }
-std::shared_ptr<InventoryComponent> PotDecorator::blueprintClone() const { return nullptr; }
-std::string PotDecorator::serialize() const { return std::string(); }
-void PotDecorator::deserialize(const std::string& data) { (void)data; }
-std::string PotDecorator::typeName() const { return "PotDecorator"; }
+double PotDecorator::getPrice() const { return PlantDecorator::getPrice() + kSurcharge; }
+
+std::shared_ptr<InventoryComponent> PotDecorator::blueprintClone() const {
+	return std::make_shared<PotDecorator>(wrappedComponent ? wrappedComponent->blueprintClone() : nullptr);
+}
 
+std::string PotDecorator::serialize() const {
+	return "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId())
+		+ ",\"data\":{\"wrapped\":" + (wrappedComponent ? wrappedComponent->serialize() : "null") + "}}";
+}
+
+void PotDecorator::deserialize(const std::string& data) { (void)data; }
+std::string_view PotDecorator::typeNameView() const { return "PotDecorator"; }
@@ -1,12 +1,22 @@
 #include "../../../include/Patterns/Decorator/RibbonDecorator.h"
+#include "../../../include/Core/Json.h"
 
 RibbonDecorator::RibbonDecorator(const std::shared_ptr<InventoryComponent>& component)
-	: PlantDecorator(component) {}
+	: PlantDecorator(component) {
+	kind_ = ComponentKind::RibbonDecorator;
+	appendToName(kSuffix);
+}
 
-std::string RibbonDecorator::getName() const { return wrappedComponent ? wrappedComponent->getName() : std::string(); }
-double RibbonDecorator::getPrice() const { return wrappedComponent ? wrappedComponent->getPrice() : 0.0; }
-std::shared_ptr<InventoryComponent> RibbonDecorator::blueprintClone() const { return nullptr; }
-std::string RibbonDecorator::serialize() const { return std::string(); }
-void RibbonDecorator::deserialize(const std::string& data) { (void)data; }
-std::string RibbonDecorator::typeName() const { return "RibbonDecorator"; }
+double RibbonDecorator::getPrice() const { return PlantDecorator::getPrice() + kSurcharge; }
+
+std::shared_ptr<InventoryComponent> RibbonDecorator::blueprintClone() const {
+	return std::make_shared<RibbonDecorator>(wrappedComponent ? wrappedComponent->blueprintClone() : nullptr);
+}
 
+std::string RibbonDecorator::serialize() const {
+	return "{\"id\":" + std::to_string(getId()) + ",\"type\":" + std::to_string(typeId())
+		+ ",\"data\":{\"wrapped\":" + (wrappedComponent ? wrappedComponent->serialize() : "null") + "}}";
+}
+
+void RibbonDecorator::deserialize(const std::string& data) { (void)data; }
+std::string_view RibbonDecorator::typeNameView() const { return "RibbonDecorator"; }
@@ -1,9 +1,20 @@
 #include "../../../include/Patterns/Factory/CactusFactory.h"
 #include "../../../include/Components/Cactus.h"
 
-CactusFactory::CactusFactory() = default;
+CactusFactory::CactusFactory(std::shared_ptr<PlantStore> store) : store(std::move(store)) {}
 
 std::shared_ptr<Plant> CactusFactory::createPlant() {
-	return nullptr;
+	static const Symbol name("Cactus");
+	return std::allocate_shared<Cactus>(PoolAllocator<Cactus>(pool()), name, 15.0, store);
+}
+
+std::vector<std::shared_ptr<Plant>> CactusFactory::createPlants(std::size_t count) {
+	return createPooled(count, store ? *store : *PlantStore::shared(), pool());
+}
+
+SlabPool& CactusFactory::pool() {
+	// Leaked on purpose: pooled plants may outlive every factory and static destructors.
+	static SlabPool* instance = new SlabPool();
+	return *instance;
 }
 
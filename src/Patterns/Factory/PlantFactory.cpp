@@ -0,0 +1,15 @@
+#include "../../../include/Patterns/Factory/PlantFactory.h"
+#include "../../../include/Components/Plant.h"
+#include "../../../include/Core/SlabPool.h"
+
+std::vector<std::shared_ptr<Plant>> PlantFactory::createPooled(std::size_t count, PlantStore& store, SlabPool& pool) {
+	std::vector<std::shared_ptr<Plant>> plants;
+	if (count == 0) return plants;
+	plants.reserve(count);
+	store.reserve(count);
+	// The first plant fixes the pool's block size, so the rest can be reserved in one slab.
+	plants.push_back(createPlant());
+	pool.reserve(count - 1);
+	while (plants.size() < count) plants.push_back(createPlant());
+	return plants;
+}
@@ -1,9 +1,20 @@
 #include "../../../include/Patterns/Factory/RoseFactory.h"
 #include "../../../include/Components/Rose.h"
 
-RoseFactory::RoseFactory() = default;
+RoseFactory::RoseFactory(std::shared_ptr<PlantStore> store) : store(std::move(store)) {}
 
 std::shared_ptr<Plant> RoseFactory::createPlant() {
-	return nullptr;
+	static const Symbol name("Rose");
+	return std::allocate_shared<Rose>(PoolAllocator<Rose>(pool()), name, 25.0, store);
+}
+
+std::vector<std::shared_ptr<Plant>> RoseFactory::createPlants(std::size_t count) {
+	return createPooled(count, store ? *store : *PlantStore::shared(), pool());
+}
+
+SlabPool& RoseFactory::pool() {
+	// Leaked on purpose: pooled plants may outlive every factory and static destructors.
+	static SlabPool* instance = new SlabPool();
+	return *instance;
 }
 
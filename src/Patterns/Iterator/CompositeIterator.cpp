@@ -4,12 +4,26 @@
 CompositeIterator::CompositeIterator(const std::shared_ptr<InventoryComponent>& root,
 									 std::unique_ptr<TraversalStrategy> traversalStrategy)
 	: strategy(std::move(traversalStrategy)) {
-	(void)root;
+	if (root && strategy) strategy->traverse(root, collection);
+	position = collection.begin();
 }
 
-CompositeIterator::~CompositeIterator() = default;
+CompositeIterator::CompositeIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots,
+									 std::unique_ptr<TraversalStrategy> traversalStrategy)
+	: strategy(std::move(traversalStrategy)) {
+	if (strategy) {
+		for (const auto& root : roots) {
+			if (root) strategy->traverse(root, collection);
+		}
+	}
+	position = collection.begin();
+}
 
-std::shared_ptr<InventoryComponent> CompositeIterator::next() { return nullptr; }
+CompositeIterator::~CompositeIterator() = default;
 
-bool CompositeIterator::hasNext() const { return false; }
+std::shared_ptr<InventoryComponent> CompositeIterator::next() {
+	if (position == collection.end()) return nullptr;
+	return *position++;
+}
 
+bool CompositeIterator::hasNext() const { return position != collection.end(); }
@@ -0,0 +1,46 @@
+#include "../../../include/Patterns/Iterator/FilteredLevelOrderTraversal.h"
+#include "../../../include/Components/Group.h"
+#include <utility>
+
+FilteredLevelOrderTraversal::FilteredLevelOrderTraversal(TraversalFilter filter) : filter(std::move(filter)) {}
+
+void FilteredLevelOrderTraversal::traverse(const std::shared_ptr<InventoryComponent>& component,
+										   std::vector<std::shared_ptr<InventoryComponent>>& collection) const {
+	if (!component) return;
+	if (filter.matches(*component)) collection.push_back(component);
+	// FIFO of the groups still to expand, in level order; a group's members follow every
+	// member of the groups queued before it, so matches come out in level order too.
+	std::vector<std::shared_ptr<InventoryComponent>> groups;
+	std::size_t head = 0;
+	auto enqueue = [this, &groups](const std::shared_ptr<InventoryComponent>& candidate) {
+		auto group = dynamic_cast<const Group*>(candidate.get());
+		if (group && filter.mayDescend(*group)) groups.push_back(candidate);
+	};
+	enqueue(component);
+	while (head < groups.size()) {
+		for (auto& child : static_cast<const Group&>(*groups[head++]).members()) {
+			enqueue(child);
+			if (filter.matches(*child)) collection.push_back(std::move(child));
+		}
+	}
+}
+
+void FilteredLevelOrderTraversal::traverse(const ComponentTree& tree, ComponentTree::Handle root,
+										   std::vector<ComponentTree::Handle>& collection) const {
+	if (root == ComponentTree::kNull) return;
+	// Only owning groups have tree children.
+	auto expands = [this, &tree](ComponentTree::Handle node) {
+		return tree.firstChild(node) != ComponentTree::kNull
+			&& filter.mayDescend(static_cast<const Group&>(*tree.component(node)));
+	};
+	if (filter.matches(*tree.component(root))) collection.push_back(root);
+	std::vector<ComponentTree::Handle> groups;
+	std::size_t head = 0;
+	if (expands(root)) groups.push_back(root);
+	while (head < groups.size()) {
+		tree.forEachChild(groups[head++], [&](ComponentTree::Handle child) {
+			if (expands(child)) groups.push_back(child);
+			if (filter.matches(*tree.component(child))) collection.push_back(child);
+		});
+	}
+}
@@ -0,0 +1,46 @@
+#include "../../../include/Patterns/Iterator/FilteredPreOrderTraversal.h"
+#include "../../../include/Components/Group.h"
+#include <utility>
+
+FilteredPreOrderTraversal::FilteredPreOrderTraversal(TraversalFilter filter) : filter(std::move(filter)) {}
+
+void FilteredPreOrderTraversal::traverse(const std::shared_ptr<InventoryComponent>& component,
+										 std::vector<std::shared_ptr<InventoryComponent>>& collection) const {
+	std::vector<std::shared_ptr<InventoryComponent>> pending{component};
+	while (!pending.empty()) {
+		auto current = std::move(pending.back());
+		pending.pop_back();
+		if (!current) continue;
+		if (auto group = dynamic_cast<Group*>(current.get()); group && filter.mayDescend(*group)) {
+			const auto children = group->members();
+			pending.insert(pending.end(), children.rbegin(), children.rend());
+		}
+		if (filter.matches(*current)) collection.push_back(std::move(current));
+	}
+}
+
+void FilteredPreOrderTraversal::traverse(const ComponentTree& tree, ComponentTree::Handle root,
+										 std::vector<ComponentTree::Handle>& collection) const {
+	if (root == ComponentTree::kNull) return;
+	// Each cursor is the next node to visit at its depth and whether its siblings follow it.
+	struct Cursor {
+		ComponentTree::Handle node;
+		bool siblings;
+	};
+	std::vector<Cursor> pending{Cursor{root, false}};
+	while (!pending.empty()) {
+		Cursor& cursor = pending.back();
+		const ComponentTree::Handle node = cursor.node;
+		const ComponentTree::Handle next = cursor.siblings ? tree.nextSibling(node) : ComponentTree::kNull;
+		if (next != ComponentTree::kNull) cursor.node = next;
+		else pending.pop_back();
+
+		const InventoryComponent& component = *tree.component(node);
+		if (filter.matches(component)) collection.push_back(node);
+		// Only owning groups have tree children.
+		const ComponentTree::Handle child = tree.firstChild(node);
+		if (child != ComponentTree::kNull && filter.mayDescend(static_cast<const Group&>(component))) {
+			pending.push_back(Cursor{child, true});
+		}
+	}
+}
@@ -0,0 +1,35 @@
+#include "../../../include/Patterns/Iterator/LazyLevelOrderIterator.h"
+#include "../../../include/Components/Group.h"
+
+LazyLevelOrderIterator::LazyLevelOrderIterator(InventoryComponent* root) : upcoming(root) {}
+
+LazyLevelOrderIterator::LazyLevelOrderIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots)
+	: roots(&roots) {
+	advance();
+}
+
+InventoryComponent* LazyLevelOrderIterator::next() {
+	InventoryComponent* current = upcoming;
+	if (!current) return nullptr;
+	if (auto group = dynamic_cast<const Group*>(current)) pending.push_back(group);
+	advance();
+	return current;
+}
+
+void LazyLevelOrderIterator::advance() {
+	upcoming = nullptr;
+	while (!pending.empty()) {
+		const Group* group = pending.front();
+		if (member == group->memberSlots()) {
+			pending.pop_front();
+			member = 0;
+			continue;
+		}
+		// Expired references leave empty slots.
+		if ((upcoming = group->memberSlot(member++))) return;
+	}
+	// This root's subtree is done; start the next one.
+	while (roots && nextRoot < roots->size()) {
+		if ((upcoming = (*roots)[nextRoot++].get())) return;
+	}
+}
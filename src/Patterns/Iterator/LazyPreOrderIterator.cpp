@@ -0,0 +1,33 @@
+#include "../../../include/Patterns/Iterator/LazyPreOrderIterator.h"
+#include "../../../include/Components/Group.h"
+
+LazyPreOrderIterator::LazyPreOrderIterator(InventoryComponent* root) : upcoming(root) {}
+
+LazyPreOrderIterator::LazyPreOrderIterator(const std::vector<std::shared_ptr<InventoryComponent>>& roots)
+	: roots(&roots) {
+	advance();
+}
+
+InventoryComponent* LazyPreOrderIterator::next() {
+	InventoryComponent* current = upcoming;
+	if (!current) return nullptr;
+	if (auto group = dynamic_cast<const Group*>(current)) stack.push_back(Frame{group, 0});
+	advance();
+	return current;
+}
+
+void LazyPreOrderIterator::advance() {
+	upcoming = nullptr;
+	while (!stack.empty()) {
+		Frame& top = stack.back();
+		if (top.member == top.group->memberSlots()) {
+			stack.pop_back();
+			continue;
+		}
+		// Expired references leave empty slots.
+		if ((upcoming = top.group->memberSlot(top.member++))) return;
+	}
+	while (roots && nextRoot < roots->size()) {
+		if ((upcoming = (*roots)[nextRoot++].get())) return;
+	}
+}
@@ -1,7 +1,25 @@
 #include "../../../include/Patterns/Iterator/LevelOrderTraversal.h"
+#include "../../../include/Components/Group.h"
 
 void LevelOrderTraversal::traverse(const std::shared_ptr<InventoryComponent>& component,
 								   std::vector<std::shared_ptr<InventoryComponent>>& collection) const {
-	(void)component; (void)collection; // stub
+	if (!component) return;
+	// The output vector doubles as the FIFO: everything after 'head' is still to be expanded.
+	std::size_t head = collection.size();
+	collection.push_back(component);
+	while (head < collection.size()) {
+		const auto group = dynamic_cast<Group*>(collection[head++].get());
+		if (!group) continue;
+		for (auto& child : group->members()) collection.push_back(std::move(child));
+	}
 }
 
+void LevelOrderTraversal::traverse(const ComponentTree& tree, ComponentTree::Handle root,
+								   std::vector<ComponentTree::Handle>& collection) const {
+	if (root == ComponentTree::kNull) return;
+	std::size_t head = collection.size();
+	collection.push_back(root);
+	while (head < collection.size()) {
+		tree.forEachChild(collection[head++], [&collection](ComponentTree::Handle child) { collection.push_back(child); });
+	}
+}
@@ -1,7 +1,23 @@
 #include "../../../include/Patterns/Iterator/PreOrderTraversal.h"
+#include "../../../include/Components/Group.h"
 
 void PreOrderTraversal::traverse(const std::shared_ptr<InventoryComponent>& component,
 								 std::vector<std::shared_ptr<InventoryComponent>>& collection) const {
-	(void)component; (void)collection; // stub
+	// Explicit stack: plots can nest deeply enough to make recursion a risk.
+	std::vector<std::shared_ptr<InventoryComponent>> pending{component};
+	while (!pending.empty()) {
+		auto current = std::move(pending.back());
+		pending.pop_back();
+		if (!current) continue;
+		if (auto group = dynamic_cast<Group*>(current.get())) {
+			const auto children = group->members();
+			pending.insert(pending.end(), children.rbegin(), children.rend());
+		}
+		collection.push_back(std::move(current));
+	}
 }
 
+void PreOrderTraversal::traverse(const ComponentTree& tree, ComponentTree::Handle root,
+								 std::vector<ComponentTree::Handle>& collection) const {
+	tree.forEachPreOrder(root, [&collection](ComponentTree::Handle node) { collection.push_back(node); });
+}
@@ -0,0 +1,48 @@
+#include "../../../include/Patterns/Iterator/TraversalFilter.h"
+#include "../../../include/Components/Plant.h"
+#include "../../../include/Patterns/Decorator/PlantDecorator.h"
+#include <utility>
+
+namespace {
+
+// The plant under any decorators, or nullptr for groups.
+const Plant* plantOf(const InventoryComponent* component) {
+	while (auto decorator = dynamic_cast<const PlantDecorator*>(component)) {
+		component = decorator->getWrappedComponent().get();
+	}
+	return dynamic_cast<const Plant*>(component);
+}
+
+} // namespace
+
+TraversalFilter::TraversalFilter(Match matches, Bound mayContain)
+	: matches(std::move(matches)), mayContain(std::move(mayContain)) {}
+
+bool TraversalFilter::mayDescend(const Group& group) const {
+	if (!mayContain || !group.owns()) return true;
+	return mayContain(group.getAggregates());
+}
+
+TraversalFilter TraversalFilter::plants(std::function<bool(const Plant&)> predicate, Bound mayContain) {
+	return TraversalFilter(
+		[predicate = std::move(predicate)](const InventoryComponent& component) {
+			const Plant* plant = plantOf(&component);
+			return plant && predicate(*plant);
+		},
+		std::move(mayContain));
+}
+
+TraversalFilter TraversalFilter::waterBelow(int32_t level) {
+	return plants([level](const Plant& plant) { return plant.getWaterLevel() < level; },
+		[level](const Group::Aggregates& totals) { return totals.minWaterLevel < level; });
+}
+
+TraversalFilter TraversalFilter::healthBelow(int32_t level) {
+	return plants([level](const Plant& plant) { return plant.getHealth() < level; },
+		[level](const Group::Aggregates& totals) { return totals.minHealth < level; });
+}
+
+TraversalFilter TraversalFilter::inStage(LifecycleStage stage) {
+	return plants([stage](const Plant& plant) { return plant.getStage() == stage; },
+		[stage](const Group::Aggregates& totals) { return totals.stageCounts[static_cast<std::size_t>(stage)] > 0; });
+}
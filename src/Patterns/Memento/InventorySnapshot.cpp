@@ -0,0 +1,113 @@
+#include "../../../include/Patterns/Memento/InventorySnapshot.h"
+#include "../../../include/Components/Group.h"
+#include "../../../include/Core/Inventory.h"
+
+#include <unordered_set>
+
+namespace {
+
+// Appends 'item' to a comma-separated JSON list body.
+void appendItem(std::string& list, const std::string& item) {
+	if (!list.empty()) list += ',';
+	list += item;
+}
+
+} // namespace
+
+void InventorySnapshot::appendJson(std::string& rootIds, std::string& components, std::string& groups) const {
+	for (const NodePtr& root : roots) appendItem(rootIds, std::to_string(root->id));
+
+	// Views reach nodes that are recorded elsewhere as well; list each node once, where pre-order first meets it.
+	std::unordered_set<const Node*> seen;
+	std::vector<const Node*> stack;
+	for (auto root = roots.rbegin(); root != roots.rend(); ++root) stack.push_back(root->get());
+	while (!stack.empty()) {
+		const Node* node = stack.back();
+		stack.pop_back();
+		if (!seen.insert(node).second) continue;
+		appendItem(components, node->record);
+		if (!node->group) continue;
+		std::string members;
+		for (const NodePtr& member : node->members) appendItem(members, std::to_string(member->id));
+		appendItem(groups, "{\"id\":" + std::to_string(node->id) + ",\"members\":[" + members + "]}");
+		for (auto member = node->members.rbegin(); member != node->members.rend(); ++member) stack.push_back(member->get());
+	}
+}
+
+std::shared_ptr<const InventorySnapshot> SnapshotRecorder::capture(const Inventory& inventory) {
+	ComponentTree& tree = ComponentTree::shared();
+	// Changes from here on are stamped with a later epoch than this capture's.
+	epoch = tree.closeChangeEpoch();
+	stats = Stats{};
+	if (entries.size() < tree.capacity()) entries.resize(tree.capacity());
+
+	std::vector<InventorySnapshot::NodePtr> roots;
+	roots.reserve(inventory.getComponents().size());
+	for (const auto& component : inventory.getComponents()) roots.push_back(record(*component));
+	// Views go last: every component they reach through the ownership tree is current by now.
+	for (std::size_t index = 0; index < pendingViews.size(); ++index) {
+		const auto pending = pendingViews[index]; // record() may append further views
+		pending.second->forEachMember([&](const InventoryComponent& member) {
+			pending.first->members.push_back(record(member));
+		});
+	}
+	pendingViews.clear();
+	return std::make_shared<const InventorySnapshot>(std::move(roots));
+}
+
+InventorySnapshot::NodePtr SnapshotRecorder::record(const InventoryComponent& component) {
+	const ComponentTree::Handle handle = component.treeNode();
+	InventorySnapshot::NodePtr previous = entries[handle].node;
+	if (previous && (previous->source != &component || previous->id != component.getId())) previous = nullptr;
+	if (previous) {
+		const uint32_t recordedAt = entries[handle].epoch;
+		// Already recorded by this capture (reached again through a view).
+		if (recordedAt == epoch) return previous;
+		// Nothing in the subtree changed since it was recorded.
+		if (!previous->volatileSubtree && ComponentTree::shared().changedAt(handle) <= recordedAt) {
+			++stats.shared;
+			entries[handle].epoch = epoch;
+			return previous;
+		}
+	}
+
+	++stats.visited;
+	auto node = std::make_shared<InventorySnapshot::Node>();
+	node->source = &component;
+	node->id = component.getId();
+	node->record = component.serialize();
+	bool pendingMembers = false;
+	if (component.kind() == ComponentKind::Group) {
+		const auto& group = static_cast<const Group&>(component);
+		node->group = true;
+		if (group.owns()) {
+			node->members.reserve(group.ownedChildren().size());
+			for (const auto& child : group.ownedChildren()) {
+				InventorySnapshot::NodePtr member = record(*child);
+				node->volatileSubtree = node->volatileSubtree || member->volatileSubtree;
+				node->members.push_back(std::move(member));
+			}
+		} else {
+			// Membership is not in the ownership tree, so no stamp tells when it changes.
+			node->volatileSubtree = true;
+			pendingMembers = true;
+			pendingViews.emplace_back(node, &group);
+		}
+	} else {
+		// Only plants report their own changes; a decorator's wrapped plant sits outside the tree.
+		node->volatileSubtree = component.kind() != ComponentKind::Rose && component.kind() != ComponentKind::Cactus;
+	}
+
+	// A re-checked component that came out the same keeps its node, and so do the paths above it.
+	InventorySnapshot::NodePtr result;
+	if (previous && !pendingMembers && previous->group == node->group && previous->record == node->record
+		&& previous->members == node->members) {
+		++stats.shared;
+		result = std::move(previous);
+	} else {
+		++stats.recorded;
+		result = std::move(node);
+	}
+	entries[handle] = Entry{result, epoch};
+	return result;
+}
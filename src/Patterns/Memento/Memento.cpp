@@ -4,3 +4,13 @@ Memento::Memento(const NurseryState& state) : state(state) {}
 
 Memento::NurseryState Memento::getState() const noexcept { return state; }
 
+
+std::string Memento::serialize() const {
+	if (!state.inventory) return state.serializedData;
+	std::string roots;
+	std::string components;
+	std::string groups;
+	state.inventory->appendJson(roots, components, groups);
+	return "{\"day\":" + std::to_string(state.day) + ",\"seed\":" + std::to_string(state.seed) + ",\"roots\":[" + roots
+		+ "],\"components\":[" + components + "],\"groups\":[" + groups + "],\"commands\":[" + state.commands + "]}";
+}
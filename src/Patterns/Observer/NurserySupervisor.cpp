@@ -1,8 +1,44 @@
 #include "../../../include/Patterns/Observer/NurserySupervisor.h"
+#include "../../../include/Core/Nursery.h"
+#include "../../../include/Components/Plant.h"
+#include "../../../include/Patterns/Command/WaterPlantCommand.h"
 
 NurserySupervisor::NurserySupervisor(const std::shared_ptr<Nursery>& nursery) : nursery(nursery) {}
 
+void NurserySupervisor::watch(Plant& plant) { plant.setWatched(true); }
+
+void NurserySupervisor::unwatch(Plant& plant) { plant.setWatched(false); }
+
+bool NurserySupervisor::isWatching(const Plant& plant) const { return plant.isWatched(); }
+
 void NurserySupervisor::update(const std::shared_ptr<Subject>& subject) {
-	(void)subject; // stub: real behavior implemented later
+	auto plant = std::dynamic_pointer_cast<Plant>(subject);
+	auto owner = nursery.lock();
+	if (!plant || !owner) return;
+	if (plant->getStage() == LifecycleStage::Withered) return;
+	if (plant->getWaterLevel() < LifecycleRules::kThirstyThreshold) {
+		owner->addRequest(std::make_unique<WaterPlantCommand>(plant));
+	}
 }
 
+void NurserySupervisor::update(const std::vector<PlantEvent>& events) {
+	auto owner = nursery.lock();
+	if (!owner) return;
+	const auto withered = static_cast<int32_t>(LifecycleStage::Withered);
+	for (std::size_t i = 0; i < events.size();) {
+		const uint64_t id = events[i].plantId;
+		bool settled = false; // the records alone show the plant needs no watering
+		for (; i < events.size() && events[i].plantId == id; ++i) {
+			const PlantEvent& event = events[i];
+			if (event.field == PlantEvent::Field::Stage && event.after == withered) settled = true;
+			if (event.field == PlantEvent::Field::WaterLevel && event.after >= LifecycleRules::kThirstyThreshold) settled = true;
+		}
+		Plant* plant = events[i - 1].plant;
+		if (settled || !plant || !isWatching(*plant) || plant->getStage() == LifecycleStage::Withered) continue;
+		if (plant->getWaterLevel() >= LifecycleRules::kThirstyThreshold) continue;
+		// Share ownership with whoever holds the plant, as Plant::resolve() does.
+		if (auto holder = plant->Subject::weak_from_this().lock()) {
+			owner->addRequest(std::make_unique<WaterPlantCommand>(std::shared_ptr<Plant>(holder, plant)));
+		}
+	}
+}
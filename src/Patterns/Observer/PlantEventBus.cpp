@@ -0,0 +1,126 @@
+#include "../../../include/Patterns/Observer/PlantEventBus.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+std::atomic<uint64_t> nextBusSerial{1};
+
+bool precedes(const PlantEvent& a, const PlantEvent& b) {
+	return a.plantId != b.plantId ? a.plantId < b.plantId : a.field < b.field;
+}
+
+// Orders 'events' by plant id, then field, keeping recorded order among equal keys.
+// Natural merge sort: a buffer is a handful of ascending runs (a tick unit records
+// its plants in slot order, a phase that touches every plant k times gives k runs),
+// so merging neighbouring runs pairwise takes a few sequential passes.
+void sortByPlant(std::vector<PlantEvent>& events, std::vector<PlantEvent>& scratch) {
+	std::vector<std::size_t> bounds{0};
+	for (std::size_t i = 1; i < events.size(); ++i) {
+		if (precedes(events[i], events[i - 1])) bounds.push_back(i);
+	}
+	if (bounds.size() == 1) return; // a serial tick usually records in id order already
+	bounds.push_back(events.size());
+	scratch.resize(events.size());
+	while (bounds.size() > 2) {
+		std::vector<std::size_t> merged{0};
+		std::size_t run = 0;
+		for (; run + 2 < bounds.size(); run += 2) {
+			// std::merge takes from the first range on ties, so equal keys keep their order.
+			std::merge(events.begin() + bounds[run], events.begin() + bounds[run + 1],
+				events.begin() + bounds[run + 1], events.begin() + bounds[run + 2], scratch.begin() + bounds[run], precedes);
+			merged.push_back(bounds[run + 2]);
+		}
+		if (run + 1 < bounds.size()) {
+			std::copy(events.begin() + bounds[run], events.begin() + bounds[run + 1], scratch.begin() + bounds[run]);
+			merged.push_back(bounds[run + 1]);
+		}
+		events.swap(scratch);
+		bounds.swap(merged);
+	}
+}
+
+} // namespace
+
+PlantEventBus::PlantEventBus() : serial(nextBusSerial.fetch_add(1, std::memory_order_relaxed)) {}
+
+PlantEventBus::~PlantEventBus() = default;
+
+void PlantEventBus::subscribe(const std::shared_ptr<PlantEventObserver>& observer) {
+	if (!observer) return;
+	subscribers.push_back(observer);
+	subscribed.store(true, std::memory_order_release);
+}
+
+void PlantEventBus::unsubscribe(const std::shared_ptr<PlantEventObserver>& observer) {
+	subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+		[&](const std::weak_ptr<PlantEventObserver>& entry) {
+			auto alive = entry.lock();
+			return !alive || alive == observer;
+		}), subscribers.end());
+	subscribed.store(!subscribers.empty(), std::memory_order_release);
+}
+
+PlantEventBus::Buffer& PlantEventBus::localBuffer() {
+	// Buffers this thread records into, one per bus it has used (keyed by bus serial).
+	struct Entry {
+		uint64_t serial;
+		Buffer* buffer;             // valid while the bus with 'serial' lives
+		std::weak_ptr<Buffer> held; // expires with that bus
+	};
+	static thread_local std::vector<Entry> entries;
+	for (const auto& entry : entries) {
+		if (entry.serial == serial) return *entry.buffer;
+	}
+	// First record on this bus: drop the entries of buses destroyed since the last one.
+	entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.held.expired(); }),
+		entries.end());
+	std::lock_guard<std::mutex> lock(buffersMutex);
+	buffers.push_back(std::make_shared<Buffer>());
+	entries.push_back({serial, buffers.back().get(), buffers.back()});
+	return *buffers.back();
+}
+
+void PlantEventBus::record(const PlantEvent& event) { localBuffer().events.push_back(event); }
+
+std::size_t PlantEventBus::publish() {
+	batch.clear();
+	{
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		for (const auto& buffer : buffers) {
+			batch.insert(batch.end(), buffer->events.begin(), buffer->events.end());
+			buffer->events.clear();
+		}
+	}
+	if (batch.empty()) return 0;
+	recorded += batch.size();
+
+	// Stable, so each plant's records of a field stay in the order they were taken.
+	sortByPlant(batch, scratch);
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < batch.size();) {
+		PlantEvent merged = batch[i];
+		for (++i; i < batch.size() && batch[i].plantId == merged.plantId && batch[i].field == merged.field; ++i) {
+			merged.after = batch[i].after;
+		}
+		if (merged.before != merged.after) batch[kept++] = merged;
+	}
+	batch.resize(kept);
+	if (batch.empty()) return 0;
+
+	// Copy live subscribers first so update() may subscribe/unsubscribe safely.
+	std::vector<std::shared_ptr<PlantEventObserver>> alive;
+	alive.reserve(subscribers.size());
+	for (const auto& entry : subscribers) {
+		if (auto observer = entry.lock()) alive.push_back(std::move(observer));
+	}
+	if (alive.size() != subscribers.size()) {
+		subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+			[](const std::weak_ptr<PlantEventObserver>& entry) { return entry.expired(); }), subscribers.end());
+		subscribed.store(!subscribers.empty(), std::memory_order_release);
+	}
+	for (const auto& observer : alive) observer->update(batch);
+	delivered += batch.size();
+	return batch.size();
+}
@@ -2,7 +2,9 @@
 
 Growing::Growing() = default;
 
-void Growing::handleStateChange(Plant* plant) { (void)plant; }
-void Growing::performDailyActivity(Plant* plant) { (void)plant; }
-std::unique_ptr<PlantState> Growing::clone() const { return std::make_unique<Growing>(); }
-
+void Growing::handleStateChange(Plant* plant) const { advanceStage(plant, stage()); }
+void Growing::performDailyActivity(Plant* plant) const {
+    applyDailyRule(plant, stage());
+    handleStateChange(plant);
+}
+LifecycleStage Growing::stage() const { return LifecycleStage::Growing; }
@@ -0,0 +1,75 @@
+#include "../../../include/Patterns/State/LifecycleEngine.h"
+
+namespace {
+
+using LifecycleRules::kTransitionCount;
+using LifecycleRules::kTransitions;
+using LifecycleRules::TransitionRule;
+using LifecycleRules::kUnbounded;
+
+// The table is a compile-time constant, so the row loop unrolls and every row
+// becomes a handful of compares and selects applied across a vector of slots.
+// Counts are kept in local arrays that the unrolled loops reduce to scalars.
+void advanceKernel(std::size_t count, uint8_t* __restrict stages, const int32_t* __restrict ages,
+                   const int32_t* __restrict healths, uint8_t* __restrict events, uint8_t changedBit,
+                   LifecycleCounters& counters) {
+    uint32_t population[kLifecycleStageCount] = {};
+    uint32_t ruleHits[kTransitionCount] = {};
+    for (std::size_t i = 0; i < count; ++i) {
+        const int32_t stage = stages[i];
+        const int32_t age = ages[i];
+        const int32_t health = healths[i];
+        int32_t next = stage;
+        int32_t matched = 0;
+        for (std::size_t row = 0; row < kTransitionCount; ++row) {
+            const TransitionRule& rule = kTransitions[row];
+            // Bounds of 0 / kUnbounded fold away: ages and health are never negative.
+            const int32_t hit = (matched == 0) & (stage == static_cast<int32_t>(rule.from))
+                & ((rule.minAge == 0) | (age >= rule.minAge)) & ((rule.maxAge == kUnbounded) | (age <= rule.maxAge))
+                & ((rule.minHealth == 0) | (health >= rule.minHealth)) & (health <= rule.maxHealth);
+            next += hit * (static_cast<int32_t>(rule.to) - next);
+            matched |= hit;
+            ruleHits[row] += static_cast<uint32_t>(hit);
+        }
+        for (std::size_t s = 0; s < kLifecycleStageCount; ++s) {
+            population[s] += static_cast<uint32_t>(next == static_cast<int32_t>(s));
+        }
+        events[i] |= static_cast<uint8_t>(matched * changedBit);
+        stages[i] = static_cast<uint8_t>(next);
+    }
+    for (std::size_t s = 0; s < kLifecycleStageCount; ++s) counters.population[s] += population[s];
+    for (std::size_t row = 0; row < kTransitionCount; ++row) counters.ruleHits[row] += ruleHits[row];
+}
+
+} // namespace
+
+void LifecycleCounters::clear() noexcept {
+    population.fill(0);
+    ruleHits.fill(0);
+}
+
+LifecycleCounters& LifecycleCounters::operator+=(const LifecycleCounters& other) noexcept {
+    for (std::size_t s = 0; s < population.size(); ++s) population[s] += other.population[s];
+    for (std::size_t row = 0; row < ruleHits.size(); ++row) ruleHits[row] += other.ruleHits[row];
+    return *this;
+}
+
+uint64_t LifecycleCounters::transitions(LifecycleStage from, LifecycleStage to) const noexcept {
+    uint64_t total = 0;
+    for (std::size_t row = 0; row < kTransitionCount; ++row) {
+        if (kTransitions[row].from == from && kTransitions[row].to == to) total += ruleHits[row];
+    }
+    return total;
+}
+
+uint64_t LifecycleCounters::totalTransitions() const noexcept {
+    uint64_t total = 0;
+    for (uint64_t hits : ruleHits) total += hits;
+    return total;
+}
+
+void LifecycleEngine::advance(std::size_t count, uint8_t* stages, const int32_t* ages, const int32_t* healths,
+                              uint8_t* events, uint8_t changedBit, LifecycleCounters* counters) {
+    LifecycleCounters discarded;
+    advanceKernel(count, stages, ages, healths, events, changedBit, counters ? *counters : discarded);
+}
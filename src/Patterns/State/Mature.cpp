@@ -2,7 +2,9 @@
 
 Mature::Mature() = default;
 
-void Mature::handleStateChange(Plant* plant) { (void)plant; }
-void Mature::performDailyActivity(Plant* plant) { (void)plant; }
-std::unique_ptr<PlantState> Mature::clone() const { return std::make_unique<Mature>(); }
-
+void Mature::handleStateChange(Plant* plant) const { advanceStage(plant, stage()); }
+void Mature::performDailyActivity(Plant* plant) const {
+    applyDailyRule(plant, stage());
+    handleStateChange(plant);
+}
+LifecycleStage Mature::stage() const { return LifecycleStage::Mature; }
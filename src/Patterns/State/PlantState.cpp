@@ -0,0 +1,38 @@
+#include "../../../include/Patterns/State/PlantState.h"
+#include "../../../include/Patterns/State/Seedling.h"
+#include "../../../include/Patterns/State/Growing.h"
+#include "../../../include/Patterns/State/Mature.h"
+#include "../../../include/Patterns/State/Withering.h"
+#include "../../../include/Patterns/State/Withered.h"
+#include "../../../include/Components/Plant.h"
+
+const PlantState& PlantState::forStage(LifecycleStage stage) {
+	static const Seedling seedling;
+	static const Growing growing;
+	static const Mature mature;
+	static const Withering withering;
+	static const Withered withered;
+	static const PlantState* const states[kLifecycleStageCount] = { &seedling, &growing, &mature, &withering, &withered };
+	return *states[static_cast<std::size_t>(stage)];
+}
+
+// Must stay in lockstep with PlantStore::tickStage(), the batched version of this rule.
+void PlantState::applyDailyRule(Plant* plant, LifecycleStage stage) {
+	using namespace LifecycleRules;
+	const StageRule& stageRule = rule(stage);
+
+	int water = plant->getWaterLevel() - (stageRule.waterUse + plant->getThirst());
+	if (water < 0) water = 0;
+	int health = plant->getHealth() + (water < kDryThreshold ? -stageRule.dryDamage : stageRule.recovery);
+	if (health < 0) health = 0;
+	if (health > kMaxLevel) health = kMaxLevel;
+
+	plant->setAge(plant->getAge() + 1);
+	plant->setWaterLevel(water);
+	plant->setHealth(health);
+}
+
+void PlantState::advanceStage(Plant* plant, LifecycleStage stage) {
+	const LifecycleStage next = LifecycleRules::nextStage(stage, plant->getAge(), plant->getHealth());
+	if (next != stage) plant->setState(forStage(next));
+}
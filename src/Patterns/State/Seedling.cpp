@@ -2,7 +2,9 @@
 
 Seedling::Seedling() = default;
 
-void Seedling::handleStateChange(Plant* plant) { (void)plant; }
-void Seedling::performDailyActivity(Plant* plant) { (void)plant; }
-std::unique_ptr<PlantState> Seedling::clone() const { return std::make_unique<Seedling>(); }
-
+void Seedling::handleStateChange(Plant* plant) const { advanceStage(plant, stage()); }
+void Seedling::performDailyActivity(Plant* plant) const {
+    applyDailyRule(plant, stage());
+    handleStateChange(plant);
+}
+LifecycleStage Seedling::stage() const { return LifecycleStage::Seedling; }
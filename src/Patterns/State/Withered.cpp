@@ -2,7 +2,7 @@
 
 Withered::Withered() = default;
 
-void Withered::handleStateChange(Plant* plant) { (void)plant; }
-void Withered::performDailyActivity(Plant* plant) { (void)plant; }
-std::unique_ptr<PlantState> Withered::clone() const { return std::make_unique<Withered>(); }
-
+// Withered is terminal: the plant no longer ages, drinks or changes stage.
+void Withered::handleStateChange(Plant* plant) const { (void)plant; }
+void Withered::performDailyActivity(Plant* plant) const { (void)plant; }
+LifecycleStage Withered::stage() const { return LifecycleStage::Withered; }
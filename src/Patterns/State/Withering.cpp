@@ -2,7 +2,9 @@
 
 Withering::Withering() = default;
 
-void Withering::handleStateChange(Plant* plant) { (void)plant; }
-void Withering::performDailyActivity(Plant* plant) { (void)plant; }
-std::unique_ptr<PlantState> Withering::clone() const { return std::make_unique<Withering>(); }
-
+void Withering::handleStateChange(Plant* plant) const { advanceStage(plant, stage()); }
+void Withering::performDailyActivity(Plant* plant) const {
+    applyDailyRule(plant, stage());
+    handleStateChange(plant);
+}
+LifecycleStage Withering::stage() const { return LifecycleStage::Withering; }